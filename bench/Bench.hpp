@@ -0,0 +1,109 @@
+#ifndef FT_BENCH_HPP
+# define FT_BENCH_HPP
+
+# include <cstddef>
+# include <cstdio>
+# include <ctime>
+
+namespace ft_bench
+{
+
+    // A benchmark runs once per size. Sizes come from the command line, or
+    // from the space-separated list given to FT_BENCH.
+    typedef void    (*BenchFn)(std::size_t n);
+
+    struct BenchCase
+    {
+        const char  *name;
+        const char  *sizes;
+        BenchFn     fn;
+        BenchCase   *next;
+    };
+
+    inline BenchCase *&benchHead()
+    {
+        static BenchCase    *head = NULL;
+
+        return head;
+    }
+
+    struct Register
+    {
+        BenchCase   self;
+
+        Register(const char *name, const char *sizes, BenchFn fn)
+        {
+            BenchCase   **tail = &benchHead();
+
+            self.name = name;
+            self.sizes = sizes;
+            self.fn = fn;
+            self.next = NULL;
+            while (*tail)
+                tail = &(*tail)->next;
+            *tail = &self;
+        }
+    };
+
+    inline double  now()
+    {
+        timespec    t;
+
+        clock_gettime(CLOCK_MONOTONIC, &t);
+        return t.tv_sec + t.tv_nsec * 1e-9;
+    }
+
+    struct Timer
+    {
+        double  start;
+
+        Timer(): start(now()) {}
+        double  elapsed() const { return now() - this->start; }
+        void    reset() { this->start = now(); }
+    };
+
+    // One result line: which container, which operation, on how many
+    // elements, how long it took and the cost of each of `ops` operations.
+    inline void report(const char *what, const char *op, std::size_t n, double seconds, std::size_t ops)
+    {
+        std::printf("  %-28s %-22s n=%-10lu %9.4fs %9.1f ns/op\n", what, op, (unsigned long)n, seconds,
+            ops ? seconds * 1e9 / ops : 0.0);
+        std::fflush(stdout);
+    }
+
+    // Keeps the optimizer from discarding a computed value.
+    template<class T>
+    inline void keep(const T &value)
+    {
+# if defined(__GNUC__) || defined(__clang__)
+        __asm__ __volatile__("" : : "g"(&value) : "memory");
+# else
+        static volatile char    sink;
+
+        sink = *reinterpret_cast<const volatile char *>(&value);
+# endif
+    }
+
+    // Deterministic xorshift generator, identical across standard libraries.
+    struct Random
+    {
+        unsigned long long  state;
+
+        explicit Random(unsigned long long seed = 88172645463325252ULL): state(seed) {}
+        unsigned long long  next()
+        {
+            this->state ^= this->state << 13;
+            this->state ^= this->state >> 7;
+            this->state ^= this->state << 17;
+            return this->state;
+        }
+    };
+
+}
+
+# define FT_BENCH(name, sizes) \
+    static void name(std::size_t n); \
+    static ft_bench::Register name##Registration(#name, sizes, name); \
+    static void name(std::size_t n)
+
+#endif
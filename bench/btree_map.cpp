@@ -0,0 +1,61 @@
+#include <map>
+#include "Bench.hpp"
+#include "map.hpp"
+#include "btree_map.hpp"
+
+namespace
+{
+    // Random insert, then finds of which half hit, then in-order scans.
+    template<class M, class P>
+    void    lookupScan(const char *label, std::size_t n)
+    {
+        const std::size_t   scans = 5;
+        ft_bench::Random    rng;
+        ft_bench::Timer     timer;
+        M                   m;
+
+        for (std::size_t i = 0; i < n; i++)
+            m.insert(P(int(rng.next() >> 1), int(i)));
+        ft_bench::report(label, "insert", n, timer.elapsed(), n);
+
+        ft_bench::Random    again;
+        long                hits = 0;
+
+        timer.reset();
+        for (std::size_t i = 0; i < n; i++)
+        {
+            int key = int(again.next() >> 1);
+
+            hits += m.find(i & 1 ? int(rng.next() >> 1) : key) != m.end();
+        }
+        ft_bench::report(label, "find", n, timer.elapsed(), n);
+
+        long    sum = 0;
+
+        timer.reset();
+        for (std::size_t r = 0; r < scans; r++)
+        {
+            for (typename M::iterator it = m.begin(); it != m.end(); ++it)
+                sum += it->second;
+        }
+        ft_bench::report(label, "scan", n, timer.elapsed(), scans * m.size());
+
+        typename M::iterator    first = m.begin();
+        typename M::iterator    last = m.begin();
+
+        for (std::size_t i = 0; i < m.size() / 2; i++)
+            ++last;
+        timer.reset();
+        m.erase(first, last);
+        ft_bench::report(label, "erase(first half)", n, timer.elapsed(), n / 2);
+        ft_bench::keep(hits);
+        ft_bench::keep(sum);
+    }
+}
+
+FT_BENCH(btree_map_lookup_scan, "1e5 1e6")
+{
+    lookupScan<std::map<int, int>, std::pair<int, int> >("std::map", n);
+    lookupScan<ft::map<int, int>, ft::pair<int, int> >("ft::map", n);
+    lookupScan<ft::btree_map<int, int>, ft::pair<int, int> >("ft::btree_map", n);
+}
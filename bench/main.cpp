@@ -0,0 +1,41 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "Bench.hpp"
+
+// ft_bench [filter] [sizes...]: runs every benchmark whose name contains
+// filter, on the given sizes or on each benchmark's default sizes.
+static void runSizes(ft_bench::BenchCase *b, const char *sizes)
+{
+    char    *end;
+
+    while (*sizes)
+    {
+        double  n = std::strtod(sizes, &end);
+
+        if (end == sizes)
+            break;
+        b->fn(static_cast<std::size_t>(n));
+        sizes = end;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char  *filter = argc > 1 ? argv[1] : "";
+
+    for (ft_bench::BenchCase *b = ft_bench::benchHead(); b; b = b->next)
+    {
+        if (!std::strstr(b->name, filter))
+            continue;
+        std::printf("%s\n", b->name);
+        if (argc > 2)
+        {
+            for (int i = 2; i < argc; i++)
+                runSizes(b, argv[i]);
+        }
+        else
+            runSizes(b, b->sizes);
+    }
+    return 0;
+}
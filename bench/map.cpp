@@ -0,0 +1,276 @@
+#include <map>
+#include "Bench.hpp"
+#include "map.hpp"
+#include "vector.hpp"
+#include "node_pool_allocator.hpp"
+
+namespace
+{
+    template<class M, class P>
+    void    insertErase(const char *label, std::size_t n)
+    {
+        ft_bench::Random    rng;
+        ft_bench::Timer     timer;
+        M                   m;
+
+        for (std::size_t i = 0; i < n; i++)
+            m.insert(P(int(rng.next()), int(i)));
+
+        double  insert = timer.elapsed();
+        ft_bench::Random    again;
+
+        timer.reset();
+        for (std::size_t i = 0; i < n; i++)
+            m.erase(int(again.next()));
+
+        ft_bench::report(label, "insert", n, insert, n);
+        ft_bench::report(label, "erase", n, timer.elapsed(), n);
+    }
+}
+
+// Random insert and erase; ns/op should grow with log n only.
+FT_BENCH(map_insert_erase_scaling, "16384 65536 262144 1048576 4194304")
+{
+    insertErase<ft::map<int, int>, ft::pair<int, int> >("ft::map", n);
+    insertErase<std::map<int, int>, std::pair<int, int> >("std::map", n);
+}
+
+namespace
+{
+    // Keys 0, 2, ..., 2n - 2 built in order through the end() hint;
+    // queries are uniform over [0, 2n), so half of them hit.
+    template<class M, class P>
+    void    boundQueries(const char *label, std::size_t n)
+    {
+        typedef typename M::iterator    iterator;
+
+        const std::size_t   queries = 1000000;
+        M                   m;
+
+        for (std::size_t i = 0; i < n; i++)
+            m.insert(m.end(), P(int(2 * i), int(i)));
+
+        ft_bench::Random    rng;
+        ft_bench::Timer     timer;
+        long                sum = 0;
+
+        for (std::size_t i = 0; i < queries; i++)
+        {
+            iterator    it = m.lower_bound(int(rng.next() % (2 * n)));
+            sum += it == m.end() ? 0 : it->second;
+        }
+        ft_bench::report(label, "lower_bound", n, timer.elapsed(), queries);
+
+        timer.reset();
+        for (std::size_t i = 0; i < queries; i++)
+        {
+            iterator    it = m.upper_bound(int(rng.next() % (2 * n)));
+            sum += it == m.end() ? 0 : it->second;
+        }
+        ft_bench::report(label, "upper_bound", n, timer.elapsed(), queries);
+
+        timer.reset();
+        for (std::size_t i = 0; i < queries; i++)
+            sum += m.count(int(rng.next() % (2 * n)));
+        ft_bench::report(label, "count", n, timer.elapsed(), queries);
+
+        timer.reset();
+        for (std::size_t i = 0; i < queries; i++)
+        {
+            iterator    it = m.equal_range(int(rng.next() % (2 * n))).first;
+            sum += it == m.end() ? 0 : it->second;
+        }
+        ft_bench::report(label, "equal_range", n, timer.elapsed(), queries);
+        ft_bench::keep(sum);
+    }
+}
+
+// Both maps use node_pool_allocator so that 10^8 keys fit in 6 GB; each
+// map is freed before the next one is built.
+FT_BENCH(map_bounds, "1e6 1e7")
+{
+    typedef ft::node_pool_allocator<ft::pair<const int, int> >  FtPool;
+    typedef ft::node_pool_allocator<std::pair<const int, int> > StdPool;
+
+    boundQueries<ft::map<int, int, std::less<int>, FtPool>, ft::pair<int, int> >("ft::map", n);
+    boundQueries<std::map<int, int, std::less<int>, StdPool>, std::pair<int, int> >("std::map", n);
+}
+
+namespace
+{
+    template<class M, class P>
+    void    hinted(const char *label, std::size_t n)
+    {
+        ft_bench::Timer timer;
+
+        {
+            M   m;
+
+            for (std::size_t i = 0; i < n; i++)
+                m.insert(m.end(), P(int(i), 0));
+            ft_bench::report(label, "sequential, end()", n, timer.elapsed(), n);
+        }
+        timer.reset();
+        {
+            M   m;
+
+            for (std::size_t i = 0; i < n; i++)
+                m.insert(P(int(i), 0));
+            ft_bench::report(label, "sequential, no hint", n, timer.elapsed(), n);
+        }
+        timer.reset();
+        {
+            M   m;
+
+            for (std::size_t i = n; i > 0; i--)
+                m.insert(m.begin(), P(int(i), 0));
+            ft_bench::report(label, "reverse, begin()", n, timer.elapsed(), n);
+        }
+        timer.reset();
+        {
+            M   m;
+
+            for (std::size_t i = n; i > 0; i--)
+                m.insert(P(int(i), 0));
+            ft_bench::report(label, "reverse, no hint", n, timer.elapsed(), n);
+        }
+        timer.reset();
+        {
+            M                   m;
+            ft_bench::Random    rng;
+
+            for (std::size_t i = 0; i < n; i++)
+                m.insert(m.end(), P(int(rng.next()), 0));
+            ft_bench::report(label, "random, end()", n, timer.elapsed(), n);
+        }
+        timer.reset();
+        {
+            M                   m;
+            ft_bench::Random    rng;
+
+            for (std::size_t i = 0; i < n; i++)
+                m.insert(P(int(rng.next()), 0));
+            ft_bench::report(label, "random, no hint", n, timer.elapsed(), n);
+        }
+    }
+}
+
+// Hinted insert: sequential and reverse keys with the matching hint should
+// cost amortized O(1); a wrong hint must not be slower than no hint.
+FT_BENCH(map_hinted_insert, "1e6")
+{
+    hinted<ft::map<int, int>, ft::pair<int, int> >("ft::map", n);
+    hinted<std::map<int, int>, std::pair<int, int> >("std::map", n);
+}
+
+namespace
+{
+    template<class M>
+    void    splitAt(const char *label, const char *op, std::size_t n, int key)
+    {
+        M   m;
+
+        for (std::size_t i = 0; i < n; i++)
+            m.insert(m.end(), ft::make_pair(int(i), int(i)));
+
+        ft_bench::Timer timer;
+        M               upper = m.split_at(key);
+
+        ft_bench::report(label, op, n, timer.elapsed(), 1);
+        ft_bench::keep(upper.size());
+    }
+
+    template<class M>
+    void    splitParts(const char *label, std::size_t n)
+    {
+        splitAt<M>(label, "split_at(n / 2)", n, int(n / 2));
+        splitAt<M>(label, "split_at(n - 1000)", n, int(n - 1000));
+        splitAt<M>(label, "split_at(1000)", n, 1000);
+    }
+}
+
+// The plain policy counts the smaller part, so splitting 1000 elements off
+// either end should not grow with n; only the even split is linear.
+FT_BENCH(map_split, "1e5 1e6 4e6")
+{
+    splitParts<ft::map<int, int> >("ft::map", n);
+    splitParts<ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::order_statistic_policy> >("ft::map order_statistic", n);
+}
+
+namespace
+{
+    // Random keys; queries alternate between present keys and random ones.
+    template<class M, class P>
+    void    buildFindQueries(M &m, ft::vector<int> &queries, std::size_t n)
+    {
+        ft_bench::Random    rng;
+        ft::vector<int>     keys;
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            int key = int(rng.next() >> 1);
+
+            m.insert(P(key, int(i)));
+            keys.push_back(key);
+        }
+        for (std::size_t i = 0; i < queries.size(); i++)
+            queries[i] = i & 1 ? keys[rng.next() % n] : int(rng.next() >> 1);
+    }
+}
+
+// find prefetches both children of each node it visits; find_many
+// interleaves independent descents.
+FT_BENCH(map_find, "1e4 1e6 4e6")
+{
+    typedef ft::map<int, int>   FtMap;
+    typedef std::map<int, int>  StdMap;
+
+    ft::vector<int> queries(1000000);
+
+    {
+        FtMap                       m;
+        ft::vector<FtMap::iterator> found(queries.size());
+        long                        sum = 0;
+
+        buildFindQueries<FtMap, ft::pair<int, int> >(m, queries, n);
+
+        ft_bench::Timer timer;
+
+        for (std::size_t i = 0; i < queries.size(); i++)
+        {
+            FtMap::iterator it = m.find(queries[i]);
+
+            if (it != m.end())
+                sum += it->second;
+        }
+        ft_bench::report("ft::map", "find", n, timer.elapsed(), queries.size());
+
+        timer.reset();
+        m.find_many(queries.begin(), queries.end(), found.begin());
+        for (std::size_t i = 0; i < found.size(); i++)
+        {
+            if (found[i] != m.end())
+                sum += found[i]->second;
+        }
+        ft_bench::report("ft::map", "find_many", n, timer.elapsed(), queries.size());
+        ft_bench::keep(sum);
+    }
+    {
+        StdMap  m;
+        long    sum = 0;
+
+        buildFindQueries<StdMap, std::pair<int, int> >(m, queries, n);
+
+        ft_bench::Timer timer;
+
+        for (std::size_t i = 0; i < queries.size(); i++)
+        {
+            StdMap::iterator    it = m.find(queries[i]);
+
+            if (it != m.end())
+                sum += it->second;
+        }
+        ft_bench::report("std::map", "find", n, timer.elapsed(), queries.size());
+        ft_bench::keep(sum);
+    }
+}
@@ -0,0 +1,61 @@
+#include <memory>
+#include <cstdio>
+#include "Bench.hpp"
+#include "vector.hpp"
+#include "small_vector.hpp"
+
+namespace
+{
+    std::size_t heapAllocations = 0;
+
+    // std::allocator that counts the blocks it hands out.
+    template<class T>
+    struct CountingAllocator: std::allocator<T>
+    {
+        template<class U>
+        struct rebind
+        {
+            typedef CountingAllocator<U>    other;
+        };
+
+        CountingAllocator() {}
+        template<class U>
+        CountingAllocator(const CountingAllocator<U> &) {}
+
+        T   *allocate(std::size_t n, const void * = 0)
+        {
+            heapAllocations++;
+            return std::allocator<T>().allocate(n);
+        }
+    };
+
+    // One short-lived vector of `size` ints per request.
+    template<class V>
+    void    requests(const char *label, const char *op, std::size_t n, std::size_t size)
+    {
+        ft_bench::Timer timer;
+        long            sum = 0;
+
+        heapAllocations = 0;
+        for (std::size_t r = 0; r < n; r++)
+        {
+            V   v;
+
+            for (std::size_t i = 0; i < size; i++)
+                v.push_back(int(r + i));
+            sum += v[size - 1];
+        }
+        ft_bench::report(label, op, n, timer.elapsed(), n);
+        std::printf("  %-28s %-22s %.2f allocations per request\n", label, "", double(heapAllocations) / n);
+        ft_bench::keep(sum);
+    }
+}
+
+// Requests that fit the inline buffer should not touch the heap at all.
+FT_BENCH(small_vector_requests, "1e6")
+{
+    requests<ft::vector<int, CountingAllocator<int> > >("ft::vector<int>", "10 push_back", n, 10);
+    requests<ft::small_vector<int, 16, CountingAllocator<int> > >("ft::small_vector<int, 16>", "10 push_back", n, 10);
+    requests<ft::vector<int, CountingAllocator<int> > >("ft::vector<int>", "40 push_back", n, 40);
+    requests<ft::small_vector<int, 16, CountingAllocator<int> > >("ft::small_vector<int, 16>", "40 push_back", n, 40);
+}
@@ -0,0 +1,56 @@
+#include <map>
+#if __cplusplus >= 201103L
+# include <unordered_map>
+#endif
+#include "Bench.hpp"
+#include "map.hpp"
+#include "unordered_map.hpp"
+
+namespace
+{
+    // n random inserts, n finds of which half hit, then n / 2 erases.
+    template<class M>
+    void    insertFindErase(const char *label, std::size_t n)
+    {
+        ft_bench::Random    rng;
+        ft_bench::Timer     timer;
+        M                   m;
+
+        for (std::size_t i = 0; i < n; i++)
+            m[int(rng.next() >> 1)] = int(i);
+        ft_bench::report(label, "insert", n, timer.elapsed(), n);
+
+        ft_bench::Random    again;
+        long                sum = 0;
+
+        timer.reset();
+        for (std::size_t i = 0; i < n; i++)
+        {
+            int                     key = int(again.next() >> 1);
+            typename M::iterator    it = m.find(i & 1 ? int(rng.next() >> 1) : key);
+
+            if (it != m.end())
+                sum += it->second;
+        }
+        ft_bench::report(label, "find", n, timer.elapsed(), n);
+
+        ft_bench::Random    erased;
+
+        timer.reset();
+        for (std::size_t i = 0; i < n / 2; i++)
+            m.erase(int(erased.next() >> 1));
+        ft_bench::report(label, "erase", n, timer.elapsed(), n / 2);
+        ft_bench::keep(sum);
+    }
+}
+
+// std::unordered_map takes part from C++11 on: make bench STD=c++11.
+FT_BENCH(unordered_map_insert_find_erase, "1e6")
+{
+    insertFindErase<ft::unordered_map<int, int> >("ft::unordered_map", n);
+#if __cplusplus >= 201103L
+    insertFindErase<std::unordered_map<int, int> >("std::unordered_map", n);
+#endif
+    insertFindErase<ft::map<int, int> >("ft::map", n);
+    insertFindErase<std::map<int, int> >("std::map", n);
+}
@@ -0,0 +1,73 @@
+#include <cstring>
+#include "Bench.hpp"
+#include "vector.hpp"
+
+namespace
+{
+    struct Buffer
+    {
+        int     idx;
+        char    buff[4096];
+    };
+
+    // Same payloads behind a user-provided copy constructor: not trivially
+    // relocatable, so every bulk move is the element-wise loop.
+    struct SlowBuffer
+    {
+        int     idx;
+        char    buff[4096];
+
+        SlowBuffer(): idx(0) { std::memset(buff, 0, sizeof(buff)); }
+        SlowBuffer(const SlowBuffer &o): idx(o.idx) { std::memcpy(buff, o.buff, sizeof(buff)); }
+        SlowBuffer  &operator=(const SlowBuffer &o)
+        {
+            idx = o.idx;
+            std::memcpy(buff, o.buff, sizeof(buff));
+            return *this;
+        }
+    };
+
+    struct SlowInt
+    {
+        int v;
+
+        SlowInt(int x = 0): v(x) {}
+        SlowInt(const SlowInt &o): v(o.v) {}
+        SlowInt &operator=(const SlowInt &o) { v = o.v; return *this; }
+    };
+
+    // n push_backs (regrowth moves), then `moves` middle erases and as many
+    // middle inserts (tail moves).
+    template<class T>
+    void    relocation(const char *label, std::size_t n, std::size_t moves)
+    {
+        ft_bench::Timer timer;
+        ft::vector<T>   v;
+
+        for (std::size_t i = 0; i < n; i++)
+            v.push_back(T());
+        ft_bench::report(label, "push_back", n, timer.elapsed(), n);
+
+        timer.reset();
+        for (std::size_t i = 0; i < moves; i++)
+            v.erase(v.begin() + (i * 37) % v.size());
+        for (std::size_t i = 0; i < moves; i++)
+            v.insert(v.begin() + (i * 53) % v.size(), T());
+        ft_bench::report(label, "middle erase+insert", n, timer.elapsed(), 2 * moves);
+        ft_bench::keep(v.size());
+    }
+}
+
+// The element-wise run goes first, so that the memmove run is the one
+// reusing memory the allocator already faulted in.
+FT_BENCH(vector_relocation_int, "1e6 1e7")
+{
+    relocation<SlowInt>("vector<int> element-wise", n, 200);
+    relocation<int>("vector<int> memmove", n, 200);
+}
+
+FT_BENCH(vector_relocation_buffer, "1e4 1e5")
+{
+    relocation<SlowBuffer>("vector<Buffer> element-wise", n, 20);
+    relocation<Buffer>("vector<Buffer> memmove", n, 20);
+}
@@ -0,0 +1,27 @@
+#ifndef FT_ALIGNED_STORAGE_HPP
+# define FT_ALIGNED_STORAGE_HPP
+
+# include <cstddef>
+
+namespace ft
+{
+
+    // Uninitialized room for N objects of type T, aligned for T even when T
+    // asks for more than the fundamental alignment. C++98 has no alignas, so
+    // it relies on the GNU aligned attribute there.
+    template<class T, std::size_t N>
+    struct AlignedStorage
+    {
+# if __cplusplus >= 201103L
+        alignas(T) unsigned char    raw[(N ? N : 1) * sizeof(T)];
+# else
+        unsigned char               raw[(N ? N : 1) * sizeof(T)] __attribute__((aligned(__alignof__(T))));
+# endif
+
+        T           *data() { return reinterpret_cast<T *>(this->raw); }
+        const T     *data() const { return reinterpret_cast<const T *>(this->raw); }
+    };
+
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef FT_ALLOC_TRAITS_HPP
+# define FT_ALLOC_TRAITS_HPP
+
+# include <memory>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+
+namespace ft
+{
+
+    // Allocator of U obtained from Alloc. std::allocator lost its rebind
+    // member in C++20, so C++11 and later go through allocator_traits.
+    template<class Alloc, class U>
+    struct RebindAlloc
+    {
+# if __cplusplus >= 201103L
+        typedef typename std::allocator_traits<Alloc>::template rebind_alloc<U>    type;
+# else
+        typedef typename Alloc::template rebind<U>::other                          type;
+# endif
+    };
+
+    // Element construction and destruction through an allocator. C++20
+    // removed construct, destroy and max_size from std::allocator as well.
+# if __cplusplus >= 201103L
+    template<class Alloc, class T, class... Args>
+    void    allocConstruct(Alloc &alloc, T *p, Args&&... args)
+    {
+        std::allocator_traits<Alloc>::construct(alloc, p, std::forward<Args>(args)...);
+    }
+
+    template<class Alloc, class T>
+    void    allocDestroy(Alloc &alloc, T *p)
+    {
+        std::allocator_traits<Alloc>::destroy(alloc, p);
+    }
+
+    template<class Alloc>
+    typename std::allocator_traits<Alloc>::size_type    allocMaxSize(const Alloc &alloc)
+    {
+        return std::allocator_traits<Alloc>::max_size(alloc);
+    }
+# else
+    template<class Alloc, class T, class V>
+    void    allocConstruct(Alloc &alloc, T *p, const V &value)
+    {
+        alloc.construct(p, value);
+    }
+
+    template<class Alloc, class T>
+    void    allocDestroy(Alloc &alloc, T *p)
+    {
+        alloc.destroy(p);
+    }
+
+    template<class Alloc>
+    typename Alloc::size_type   allocMaxSize(const Alloc &alloc)
+    {
+        return alloc.max_size();
+    }
+# endif
+
+}
+
+#endif
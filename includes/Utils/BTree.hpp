@@ -0,0 +1,135 @@
+#ifndef FT_BTREE_HPP
+# define FT_BTREE_HPP
+
+# include <cstddef>
+# include "AlignedStorage.hpp"
+
+namespace ft
+{
+
+    template<class T, std::size_t Slots>
+    struct BTreeInternalNode;
+
+    // Node of ft::btree_map. Up to Slots values live inline in one array so
+    // that a lookup touches a handful of cache lines per level. Internal nodes
+    // add Slots + 1 child pointers; value i separates children i and i + 1.
+    template<class T, std::size_t Slots>
+    struct BTreeNode
+    {
+        typedef T               value_type;
+        typedef std::size_t     size_type;
+
+        BTreeNode       *parent;
+        unsigned short  position;
+        unsigned short  count;
+        bool            leaf;
+        AlignedStorage<T, Slots>    storage;
+
+        explicit BTreeNode(bool isLeaf): parent(NULL), position(0), count(0), leaf(isLeaf) {}
+
+        T           *values() { return this->storage.data(); }
+        const T     *values() const { return this->storage.data(); }
+
+        BTreeNode   *&child(size_type i)
+        {
+            return static_cast<BTreeInternalNode<T, Slots> *>(this)->children[i];
+        }
+
+        BTreeNode   *child(size_type i) const
+        {
+            return static_cast<const BTreeInternalNode<T, Slots> *>(this)->children[i];
+        }
+    };
+
+    template<class T, std::size_t Slots>
+    struct BTreeInternalNode: BTreeNode<T, Slots>
+    {
+        BTreeNode<T, Slots> *children[Slots + 1];
+
+        BTreeInternalNode(): BTreeNode<T, Slots>(false) {}
+    };
+
+    // Number of values that fit in a leaf of about NodeBytes bytes, at least 3.
+    template<class T, std::size_t NodeBytes>
+    struct BTreeSlots
+    {
+        static const std::size_t    header = 2 * sizeof(void *);
+        static const std::size_t    fit = NodeBytes > header ? (NodeBytes - header) / sizeof(T) : 0;
+        static const std::size_t    value = fit < 3 ? 3 : (fit > 0xFFFF ? 0xFFFF : fit);
+    };
+
+    template<class Node>
+    Node    *leftmostLeaf(Node *node)
+    {
+        while (!node->leaf)
+            node = node->child(0);
+        return node;
+    }
+
+    template<class Node>
+    Node    *rightmostLeaf(Node *node)
+    {
+        while (!node->leaf)
+            node = node->child(node->count);
+        return node;
+    }
+
+    // In-order stepping over (node, pos) positions. The past-the-end position
+    // is (rightmost leaf, count); stepping past it or before the first value
+    // leaves the position unchanged.
+    template<class Node>
+    void    btreeNext(Node *&node, std::size_t &pos)
+    {
+        if (!node->leaf)
+        {
+            node = leftmostLeaf(node->child(pos + 1));
+            pos = 0;
+            return;
+        }
+        if (++pos < node->count)
+            return;
+        Node        *saveNode = node;
+        std::size_t savePos = pos;
+
+        while (pos == node->count && node->parent)
+        {
+            pos = node->position;
+            node = node->parent;
+        }
+        if (pos == node->count)
+        {
+            node = saveNode;
+            pos = savePos;
+        }
+    }
+
+    template<class Node>
+    void    btreePrev(Node *&node, std::size_t &pos)
+    {
+        if (!node->leaf)
+        {
+            node = rightmostLeaf(node->child(pos));
+            pos = node->count - 1;
+            return;
+        }
+        if (pos > 0)
+        {
+            pos--;
+            return;
+        }
+        Node        *saveNode = node;
+
+        while (pos == 0 && node->parent)
+        {
+            pos = node->position;
+            node = node->parent;
+        }
+        if (pos == 0)
+            node = saveNode;
+        else
+            pos--;
+    }
+
+}
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef FT_BTREE_ITERATOR_HPP
+# define FT_BTREE_ITERATOR_HPP
+
+# include <iterator>
+# include "BTree.hpp"
+
+namespace ft
+{
+
+    // Bidirectional iterator over a (node, position) pair. Value is the
+    // element type seen through the iterator, const for const_iterator.
+    template<class Node, class Value>
+    class BTreeIterator
+    {
+        public:
+            typedef std::bidirectional_iterator_tag     iterator_category;
+            typedef typename Node::value_type           value_type;
+            typedef std::ptrdiff_t                      difference_type;
+            typedef Value                               &reference;
+            typedef Value                               *pointer;
+            typedef Node                                *node_ptr;
+            typedef std::size_t                         size_type;
+
+        private:
+            node_ptr    ptr;
+            size_type   pos;
+
+        public:
+            BTreeIterator(): ptr(), pos(0) {}
+            BTreeIterator(node_ptr p, size_type i): ptr(p), pos(i) {}
+            BTreeIterator(const BTreeIterator &other): ptr(other.ptr), pos(other.pos) {}
+            template<class V>
+            BTreeIterator(const BTreeIterator<Node, V> &other): ptr(other.base()), pos(other.index()) {}
+            ~BTreeIterator() {}
+
+            node_ptr    base() const { return this->ptr; }
+            size_type   index() const { return this->pos; }
+
+            BTreeIterator   &operator=(const BTreeIterator &other)
+            {
+                this->ptr = other.ptr;
+                this->pos = other.pos;
+                return *this;
+            }
+
+            reference   operator*() const
+            {
+                return this->ptr->values()[this->pos];
+            }
+
+            pointer     operator->() const
+            {
+                return &this->ptr->values()[this->pos];
+            }
+
+            BTreeIterator   &operator++()
+            {
+                btreeNext(this->ptr, this->pos);
+                return *this;
+            }
+
+            BTreeIterator   operator++(int)
+            {
+                BTreeIterator   temp(*this);
+
+                ++(*this);
+                return temp;
+            }
+
+            BTreeIterator   &operator--()
+            {
+                btreePrev(this->ptr, this->pos);
+                return *this;
+            }
+
+            BTreeIterator   operator--(int)
+            {
+                BTreeIterator   temp(*this);
+
+                --(*this);
+                return temp;
+            }
+
+            template<class V>
+            bool operator==(const BTreeIterator<Node, V> &other) const
+            {
+                return this->ptr == other.base() && this->pos == other.index();
+            }
+
+            template<class V>
+            bool operator!=(const BTreeIterator<Node, V> &other) const
+            {
+                return !(*this == other);
+            }
+    };
+
+}
+
+#endif
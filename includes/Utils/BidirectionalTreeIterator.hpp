@@ -15,6 +15,7 @@ namespace ft
             typedef typename T::value_type      value_type;
             typedef typename T::value_type      &reference;
             typedef typename T::value_type      *pointer;
+            typedef std::ptrdiff_t              difference_type;
 
         private:
             node_ptr    ptr;
@@ -25,6 +26,8 @@ namespace ft
             BidirectionalTreeIterator(const BidirectionalTreeIterator &other): ptr(other.ptr) {}
             ~BidirectionalTreeIterator() {}
 
+            node_ptr    base() const { return this->ptr; }
+
             const BidirectionalTreeIterator     &operator=(const BidirectionalTreeIterator &other)
             {
                 this->ptr = other.ptr;
@@ -58,7 +61,7 @@ namespace ft
 
             BidirectionalTreeIterator   &operator--()
             {
-                this->ptr = treePrevIter<value_type>(this->ptr);
+                this->ptr = treePrevIter(this->ptr);
                 return *this;
             }
 
@@ -70,12 +73,45 @@ namespace ft
                 return temp;
             }
 
-            bool operator==(const BidirectionalTreeIterator &other)
+            // Linear in general, logarithmic when the nodes carry subtree
+            // sizes (order_statistic_policy).
+            BidirectionalTreeIterator   &operator+=(difference_type n)
+            {
+                this->ptr = treeAdvance(this->ptr, n, typename T::policy_type());
+                return *this;
+            }
+
+            BidirectionalTreeIterator   &operator-=(difference_type n)
+            {
+                this->ptr = treeAdvance(this->ptr, -n, typename T::policy_type());
+                return *this;
+            }
+
+            BidirectionalTreeIterator   operator+(difference_type n) const
+            {
+                BidirectionalTreeIterator   temp(*this);
+
+                return temp += n;
+            }
+
+            BidirectionalTreeIterator   operator-(difference_type n) const
+            {
+                BidirectionalTreeIterator   temp(*this);
+
+                return temp -= n;
+            }
+
+            difference_type operator-(const BidirectionalTreeIterator &other) const
+            {
+                return treeDistance(other.ptr, this->ptr, typename T::policy_type());
+            }
+
+            bool operator==(const BidirectionalTreeIterator &other) const
             {
                 return this->ptr == other.ptr;
             }
 
-            bool operator!=(const BidirectionalTreeIterator &other)
+            bool operator!=(const BidirectionalTreeIterator &other) const
             {
                 return this->ptr != other.ptr;
             }
@@ -143,12 +179,12 @@ namespace ft
                 return temp;
             }
 
-            bool operator==(const RevBidirectionalTreeIterator &other)
+            bool operator==(const RevBidirectionalTreeIterator &other) const
             {
                 return this->ptr == other.ptr;
             }
 
-            bool operator!=(const RevBidirectionalTreeIterator &other)
+            bool operator!=(const RevBidirectionalTreeIterator &other) const
             {
                 return this->ptr != other.ptr;
             }
@@ -0,0 +1,149 @@
+#ifndef FT_FLAT_MAP_ITERATOR_HPP
+# define FT_FLAT_MAP_ITERATOR_HPP
+
+# include <cstddef>
+# include <iterator>
+# include "Pair.hpp"
+
+namespace ft
+{
+
+    // operator-> of iterators whose reference is a proxy object: keeps the
+    // proxy alive for the duration of the member access.
+    template<class Reference>
+    class ArrowProxy
+    {
+        private:
+            Reference   ref;
+
+        public:
+            ArrowProxy(const Reference &r): ref(r) {}
+
+            const Reference *operator->() const { return &this->ref; }
+    };
+
+    // Element seen through a flat_map iterator: references into the key and
+    // mapped arrays, convertible to the stored pair.
+    template<class Key, class Mapped>
+    struct FlatMapReference
+    {
+        const Key   &first;
+        Mapped      &second;
+
+        FlatMapReference(const Key &k, Mapped &m): first(k), second(m) {}
+
+        template<class K, class V>
+        operator pair<K, V>() const { return pair<K, V>(this->first, this->second); }
+    };
+
+    // Random access iterator walking the parallel key and mapped arrays of
+    // ft::flat_map. Mapped is const T for const_iterator.
+    template<class Key, class T, class Mapped>
+    class FlatMapIterator
+    {
+        public:
+            typedef std::random_access_iterator_tag     iterator_category;
+            typedef pair<Key, T>                        value_type;
+            typedef std::ptrdiff_t                      difference_type;
+            typedef FlatMapReference<Key, Mapped>       reference;
+            typedef ArrowProxy<reference>               pointer;
+
+        private:
+            const Key   *key;
+            Mapped      *mapped;
+
+        public:
+            FlatMapIterator(): key(NULL), mapped(NULL) {}
+            FlatMapIterator(const Key *k, Mapped *m): key(k), mapped(m) {}
+            FlatMapIterator(const FlatMapIterator &other): key(other.key), mapped(other.mapped) {}
+            template<class M>
+            FlatMapIterator(const FlatMapIterator<Key, T, M> &other): key(other.keyBase()), mapped(other.mappedBase()) {}
+            ~FlatMapIterator() {}
+
+            const Key   *keyBase() const { return this->key; }
+            Mapped      *mappedBase() const { return this->mapped; }
+
+            FlatMapIterator &operator=(const FlatMapIterator &other)
+            {
+                this->key = other.key;
+                this->mapped = other.mapped;
+                return *this;
+            }
+
+            reference   operator*() const { return reference(*this->key, *this->mapped); }
+            pointer     operator->() const { return pointer(**this); }
+            reference   operator[](difference_type n) const { return reference(this->key[n], this->mapped[n]); }
+
+            FlatMapIterator &operator++()
+            {
+                ++this->key;
+                ++this->mapped;
+                return *this;
+            }
+
+            FlatMapIterator operator++(int)
+            {
+                FlatMapIterator temp(*this);
+
+                ++(*this);
+                return temp;
+            }
+
+            FlatMapIterator &operator--()
+            {
+                --this->key;
+                --this->mapped;
+                return *this;
+            }
+
+            FlatMapIterator operator--(int)
+            {
+                FlatMapIterator temp(*this);
+
+                --(*this);
+                return temp;
+            }
+
+            FlatMapIterator &operator+=(difference_type n)
+            {
+                this->key += n;
+                this->mapped += n;
+                return *this;
+            }
+
+            FlatMapIterator &operator-=(difference_type n)
+            {
+                this->key -= n;
+                this->mapped -= n;
+                return *this;
+            }
+
+            FlatMapIterator operator+(difference_type n) const { return FlatMapIterator(this->key + n, this->mapped + n); }
+            FlatMapIterator operator-(difference_type n) const { return FlatMapIterator(this->key - n, this->mapped - n); }
+
+            template<class M>
+            difference_type operator-(const FlatMapIterator<Key, T, M> &other) const { return this->key - other.keyBase(); }
+
+            template<class M>
+            bool    operator==(const FlatMapIterator<Key, T, M> &other) const { return this->key == other.keyBase(); }
+            template<class M>
+            bool    operator!=(const FlatMapIterator<Key, T, M> &other) const { return this->key != other.keyBase(); }
+            template<class M>
+            bool    operator<(const FlatMapIterator<Key, T, M> &other) const { return this->key < other.keyBase(); }
+            template<class M>
+            bool    operator>(const FlatMapIterator<Key, T, M> &other) const { return this->key > other.keyBase(); }
+            template<class M>
+            bool    operator<=(const FlatMapIterator<Key, T, M> &other) const { return this->key <= other.keyBase(); }
+            template<class M>
+            bool    operator>=(const FlatMapIterator<Key, T, M> &other) const { return this->key >= other.keyBase(); }
+    };
+
+    template<class Key, class T, class Mapped>
+    FlatMapIterator<Key, T, Mapped> operator+(std::ptrdiff_t n, const FlatMapIterator<Key, T, Mapped> &it)
+    {
+        return it + n;
+    }
+
+}
+
+#endif
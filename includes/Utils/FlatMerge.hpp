@@ -0,0 +1,146 @@
+#ifndef FT_FLAT_MERGE_HPP
+# define FT_FLAT_MERGE_HPP
+
+# include <cstddef>
+# include <algorithm>
+# include "Pair.hpp"
+# include "Relocate.hpp"
+
+namespace ft
+{
+
+    // The sorted arrays of ft::flat_set: a single key container, filled from
+    // batches of keys.
+    template<class Keys>
+    struct FlatKeyColumns
+    {
+        typedef typename Keys::value_type   key_type;
+        typedef key_type                    batch_type;
+
+        Keys    &keys;
+
+        explicit FlatKeyColumns(Keys &k): keys(k) {}
+
+        static const key_type   &batchKey(const batch_type &value) { return value; }
+
+        std::size_t     size() const { return this->keys.size(); }
+        const key_type  &key(std::size_t i) const { return this->keys[i]; }
+        void            reserve(std::size_t n) { this->keys.reserve(n); }
+        void            pushBatch(batch_type &value) { this->keys.push_back(moveValue(value)); }
+        void            pushFrom(FlatKeyColumns &other, std::size_t i) { this->keys.push_back(moveValue(other.keys[i])); }
+        void            swap(FlatKeyColumns &other) { this->keys.swap(other.keys); }
+    };
+
+    // The sorted arrays of ft::flat_map: parallel key and mapped containers,
+    // filled from batches of pairs.
+    template<class Keys, class Values>
+    struct FlatPairColumns
+    {
+        typedef typename Keys::value_type                           key_type;
+        typedef pair<key_type, typename Values::value_type>         batch_type;
+
+        Keys    &keys;
+        Values  &values;
+
+        FlatPairColumns(Keys &k, Values &v): keys(k), values(v) {}
+
+        static const key_type   &batchKey(const batch_type &value) { return value.first; }
+
+        std::size_t     size() const { return this->keys.size(); }
+        const key_type  &key(std::size_t i) const { return this->keys[i]; }
+
+        void    reserve(std::size_t n)
+        {
+            this->keys.reserve(n);
+            this->values.reserve(n);
+        }
+
+        void    pushBatch(batch_type &value)
+        {
+            this->keys.push_back(moveValue(value.first));
+            this->values.push_back(moveValue(value.second));
+        }
+
+        void    pushFrom(FlatPairColumns &other, std::size_t i)
+        {
+            this->keys.push_back(moveValue(other.keys[i]));
+            this->values.push_back(moveValue(other.values[i]));
+        }
+
+        void    swap(FlatPairColumns &other)
+        {
+            this->keys.swap(other.keys);
+            this->values.swap(other.values);
+        }
+    };
+
+    template<class Columns, class Compare>
+    struct FlatBatchLess
+    {
+        Compare     comp;
+
+        explicit FlatBatchLess(Compare c): comp(c) {}
+
+        bool    operator()(const typename Columns::batch_type &x, const typename Columns::batch_type &y) const
+        {
+            return this->comp(Columns::batchKey(x), Columns::batchKey(y));
+        }
+    };
+
+    // Range insert of the flat containers. Sorts the batch b[0, m) (stable,
+    // so the first of equal keys wins) unless it is already sorted, drops
+    // keys that repeat, then either appends it or merges it with the
+    // current contents in a single pass through `merged`, an empty view
+    // whose containers end up holding the old contents. Keys already
+    // present keep their value.
+    template<class Columns, class Compare>
+    void    mergeSortedBatch(Columns &target, Columns &merged, typename Columns::batch_type *b, std::size_t m, bool sorted, Compare comp)
+    {
+        std::size_t n = target.size();
+
+        if (m == 0)
+            return;
+        if (!sorted)
+        {
+            std::size_t out = 1;
+
+            std::stable_sort(b, b + m, FlatBatchLess<Columns, Compare>(comp));
+            for (std::size_t r = 1; r < m; r++)
+            {
+                if (comp(Columns::batchKey(b[out - 1]), Columns::batchKey(b[r])))
+                {
+                    if (out != r)
+                        b[out] = moveValue(b[r]);
+                    out++;
+                }
+            }
+            m = out;
+        }
+        if (n == 0 || comp(target.key(n - 1), Columns::batchKey(b[0])))
+        {
+            target.reserve(n + m);
+            for (std::size_t j = 0; j < m; j++)
+                target.pushBatch(b[j]);
+            return;
+        }
+        std::size_t i = 0;
+        std::size_t j = 0;
+
+        merged.reserve(n + m);
+        while (i < n || j < m)
+        {
+            if (j == m || (i < n && !comp(Columns::batchKey(b[j]), target.key(i))))
+            {
+                if (j < m && !comp(target.key(i), Columns::batchKey(b[j])))
+                    j++;
+                merged.pushFrom(target, i++);
+            }
+            else
+                merged.pushBatch(b[j++]);
+        }
+        target.swap(merged);
+    }
+
+}
+
+#endif
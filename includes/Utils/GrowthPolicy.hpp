@@ -0,0 +1,92 @@
+#ifndef FT_GROWTH_POLICY_HPP
+# define FT_GROWTH_POLICY_HPP
+
+# include <cstddef>
+# include <limits>
+
+namespace ft
+{
+
+    // Capacity policies of ft::vector. grow() picks the capacity to move to
+    // when an insertion needs room for `needed` elements; round() adjusts an
+    // explicit reserve(). Both return at least `needed` elements, or a value
+    // the vector will reject with length_error.
+    struct doubling_growth_policy
+    {
+        static std::size_t  grow(std::size_t cap, std::size_t needed, std::size_t)
+        {
+            std::size_t n = cap ? cap * 2 : 2;
+
+            return n < needed || n < cap ? needed : n;
+        }
+
+        static std::size_t  round(std::size_t n, std::size_t) { return n; }
+    };
+
+    // Leaves up to a third of the buffer unused instead of half, and lets a
+    // new buffer reuse the space freed by earlier ones.
+    struct factor_1_5_growth_policy
+    {
+        static std::size_t  grow(std::size_t cap, std::size_t needed, std::size_t)
+        {
+            std::size_t n = cap > 1 ? cap + cap / 2 : 2;
+
+            return n < needed || n < cap ? needed : n;
+        }
+
+        static std::size_t  round(std::size_t n, std::size_t) { return n; }
+    };
+
+    // Rounds n elements up so that they fill whole blocks of `block` bytes.
+    // Buffers smaller than one block are left alone.
+    inline std::size_t  roundToBlock(std::size_t n, std::size_t elemSize, std::size_t block)
+    {
+        if (n < block / elemSize || n > (std::numeric_limits<std::size_t>::max() - block) / elemSize)
+            return n;
+        return ((n * elemSize + block - 1) / block * block) / elemSize;
+    }
+
+    // Rounds buffers up to whole pages: the tail of the last page is paid
+    // for anyway once the allocator hands out page-sized blocks.
+    template<class Base = doubling_growth_policy>
+    struct page_growth_policy
+    {
+        static const std::size_t    page = 4096;
+
+        static std::size_t  grow(std::size_t cap, std::size_t needed, std::size_t elemSize)
+        {
+            return round(Base::grow(cap, needed, elemSize), elemSize);
+        }
+
+        static std::size_t  round(std::size_t n, std::size_t elemSize) { return roundToBlock(n, elemSize, page); }
+    };
+
+    // Page rounding for small buffers, 2 MiB rounding from 2 MiB up, so that
+    // large buffers can be backed by transparent huge pages end to end.
+    template<class Base = doubling_growth_policy>
+    struct huge_page_growth_policy
+    {
+        static const std::size_t    hugePage = std::size_t(2) << 20;
+
+        static std::size_t  grow(std::size_t cap, std::size_t needed, std::size_t elemSize)
+        {
+            return round(Base::grow(cap, needed, elemSize), elemSize);
+        }
+
+        static std::size_t  round(std::size_t n, std::size_t elemSize)
+        {
+            std::size_t rounded = roundToBlock(n, elemSize, hugePage);
+
+            return rounded != n ? rounded : roundToBlock(n, elemSize, page_growth_policy<Base>::page);
+        }
+    };
+
+    template<class Base>
+    const std::size_t   page_growth_policy<Base>::page;
+
+    template<class Base>
+    const std::size_t   huge_page_growth_policy<Base>::hugePage;
+
+}
+
+#endif
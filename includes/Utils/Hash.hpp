@@ -0,0 +1,66 @@
+#ifndef FT_HASH_HPP
+# define FT_HASH_HPP
+
+# include <cstddef>
+# include <string>
+
+namespace ft
+{
+
+    // Default hasher of the unordered containers. Integers and pointers hash
+    // to their own value; the table mixes every hash before using it, so a
+    // weak function such as this one still spreads over the buckets.
+    template<class T>
+    struct hash;
+
+# define FT_HASH_IDENTITY(T) \
+    template<> \
+    struct hash<T> \
+    { \
+        std::size_t operator()(T x) const { return static_cast<std::size_t>(x); } \
+    };
+
+    FT_HASH_IDENTITY(bool)
+    FT_HASH_IDENTITY(char)
+    FT_HASH_IDENTITY(signed char)
+    FT_HASH_IDENTITY(unsigned char)
+    FT_HASH_IDENTITY(wchar_t)
+    FT_HASH_IDENTITY(short)
+    FT_HASH_IDENTITY(unsigned short)
+    FT_HASH_IDENTITY(int)
+    FT_HASH_IDENTITY(unsigned int)
+    FT_HASH_IDENTITY(long)
+    FT_HASH_IDENTITY(unsigned long)
+# if __cplusplus >= 201103L
+    FT_HASH_IDENTITY(long long)
+    FT_HASH_IDENTITY(unsigned long long)
+# endif
+
+# undef FT_HASH_IDENTITY
+
+    template<class T>
+    struct hash<T *>
+    {
+        std::size_t operator()(T *p) const { return reinterpret_cast<std::size_t>(p); }
+    };
+
+    // FNV-1a over the characters.
+    template<>
+    struct hash<std::string>
+    {
+        std::size_t operator()(const std::string &s) const
+        {
+            std::size_t h = 2166136261u;
+
+            for (std::string::size_type i = 0; i < s.size(); i++)
+            {
+                h ^= static_cast<unsigned char>(s[i]);
+                h *= 16777619u;
+            }
+            return h;
+        }
+    };
+
+}
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef FT_HASH_GROUP_HPP
+# define FT_HASH_GROUP_HPP
+
+# include <cstddef>
+# ifdef __SSE2__
+#  include <emmintrin.h>
+# endif
+
+namespace ft
+{
+
+    // Control bytes of the open-addressing table, one per slot. A full slot
+    // stores the low 7 bits of its hash (H2), so a lookup rejects almost
+    // every non-matching slot without touching it.
+    struct HashCtrl
+    {
+        static const signed char    empty = -128;
+        static const signed char    deleted = -2;
+        static const signed char    sentinel = -1;
+    };
+
+    inline unsigned hashTrailingZeros(unsigned x)
+    {
+# if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctz(x);
+# else
+        unsigned n = 0;
+
+        while (!(x & 1))
+        {
+            x >>= 1;
+            n++;
+        }
+        return n;
+# endif
+    }
+
+    // Number of zero bits above the highest set bit of a 16-bit mask.
+    inline unsigned hashLeadingZeros16(unsigned x)
+    {
+        unsigned n = 0;
+
+        for (unsigned bit = 0x8000; bit && !(x & bit); bit >>= 1)
+            n++;
+        return n;
+    }
+
+    // Sixteen consecutive control bytes, matched at once with SSE2. Every
+    // match returns a bitmask with bit i set for byte i.
+    struct HashGroup
+    {
+        static const std::size_t    width = 16;
+
+# ifdef __SSE2__
+        __m128i ctrl;
+
+        explicit HashGroup(const signed char *p): ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))) {}
+
+        unsigned    match(signed char h2) const
+        {
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), this->ctrl));
+        }
+
+        unsigned    matchEmpty() const { return this->match(HashCtrl::empty); }
+
+        unsigned    matchEmptyOrDeleted() const
+        {
+            return _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(HashCtrl::sentinel), this->ctrl));
+        }
+# else
+        const signed char   *ctrl;
+
+        explicit HashGroup(const signed char *p): ctrl(p) {}
+
+        unsigned    match(signed char h2) const
+        {
+            unsigned    mask = 0;
+
+            for (std::size_t i = 0; i < width; i++)
+                if (this->ctrl[i] == h2)
+                    mask |= 1u << i;
+            return mask;
+        }
+
+        unsigned    matchEmpty() const { return this->match(HashCtrl::empty); }
+
+        unsigned    matchEmptyOrDeleted() const
+        {
+            unsigned    mask = 0;
+
+            for (std::size_t i = 0; i < width; i++)
+                if (this->ctrl[i] < HashCtrl::sentinel)
+                    mask |= 1u << i;
+            return mask;
+        }
+# endif
+
+        // Empty or deleted bytes before the first full or sentinel byte.
+        unsigned    countLeadingEmptyOrDeleted() const
+        {
+            return hashTrailingZeros(~this->matchEmptyOrDeleted());
+        }
+    };
+
+}
+
+#endif
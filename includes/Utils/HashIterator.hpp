@@ -0,0 +1,84 @@
+#ifndef FT_HASH_ITERATOR_HPP
+# define FT_HASH_ITERATOR_HPP
+
+# include <cstddef>
+# include <iterator>
+# include "HashGroup.hpp"
+
+namespace ft
+{
+
+    // Forward iterator over the slots of a HashTable, paired with their
+    // control bytes. Empty and deleted slots are skipped a group at a time;
+    // the sentinel control byte marks the end.
+    template<class Value>
+    class HashIterator
+    {
+        public:
+            typedef std::forward_iterator_tag   iterator_category;
+            typedef Value                       value_type;
+            typedef std::ptrdiff_t              difference_type;
+            typedef Value                       &reference;
+            typedef Value                       *pointer;
+
+        private:
+            const signed char   *ctrl;
+            Value               *slot;
+
+        public:
+            HashIterator(): ctrl(NULL), slot(NULL) {}
+            HashIterator(const signed char *c, Value *s): ctrl(c), slot(s) {}
+            HashIterator(const HashIterator &other): ctrl(other.ctrl), slot(other.slot) {}
+            template<class V>
+            HashIterator(const HashIterator<V> &other): ctrl(other.ctrlBase()), slot(other.slotBase()) {}
+            ~HashIterator() {}
+
+            const signed char   *ctrlBase() const { return this->ctrl; }
+            Value               *slotBase() const { return this->slot; }
+
+            HashIterator    &operator=(const HashIterator &other)
+            {
+                this->ctrl = other.ctrl;
+                this->slot = other.slot;
+                return *this;
+            }
+
+            reference   operator*() const { return *this->slot; }
+            pointer     operator->() const { return this->slot; }
+
+            HashIterator    &skipEmpty()
+            {
+                while (*this->ctrl < HashCtrl::sentinel)
+                {
+                    unsigned    shift = HashGroup(this->ctrl).countLeadingEmptyOrDeleted();
+
+                    this->ctrl += shift;
+                    this->slot += shift;
+                }
+                return *this;
+            }
+
+            HashIterator    &operator++()
+            {
+                ++this->ctrl;
+                ++this->slot;
+                return this->skipEmpty();
+            }
+
+            HashIterator    operator++(int)
+            {
+                HashIterator    temp(*this);
+
+                ++(*this);
+                return temp;
+            }
+
+            template<class V>
+            bool operator==(const HashIterator<V> &other) const { return this->slot == other.slotBase(); }
+            template<class V>
+            bool operator!=(const HashIterator<V> &other) const { return this->slot != other.slotBase(); }
+    };
+
+}
+
+#endif
@@ -0,0 +1,643 @@
+#ifndef FT_HASH_TABLE_HPP
+# define FT_HASH_TABLE_HPP
+
+# include <cstddef>
+# include <cstring>
+# include <limits>
+# include <algorithm>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+# include "Pair.hpp"
+# include "Relocate.hpp"
+# include "AllocTraits.hpp"
+# include "TypeTraits.hpp"
+# include "HashGroup.hpp"
+# include "HashIterator.hpp"
+
+namespace ft
+{
+
+    // Spreads the bits of a user hash so that identity hashes of integers
+    // still fill H1 and H2 uniformly.
+    inline std::size_t hashMix(std::size_t h)
+    {
+        const std::size_t   k = (static_cast<std::size_t>(0x9E3779B9u) << 16 << 16) | 0x7F4A7C15u;
+
+        h *= k;
+        return h ^ (h >> (sizeof(std::size_t) * 4));
+    }
+
+    template<class Key>
+    struct HashKeyOfPair
+    {
+        template<class P>
+        const Key   &operator()(const P &p) const { return p.first; }
+    };
+
+    template<class Key>
+    struct HashKeyOfSelf
+    {
+        const Key   &operator()(const Key &k) const { return k; }
+    };
+
+    // True when both Hash and KeyEqual declare is_transparent, enabling the
+    // find/count/equal_range overloads that take any K comparable with keys.
+    template<class T>
+    struct HashHasTransparent
+    {
+        template<class U>
+        static char test(typename U::is_transparent *);
+        template<class U>
+        static long test(...);
+
+        static const bool   value = sizeof(test<T>(0)) == 1;
+    };
+
+    template<class Hash, class KeyEqual, class K>
+    struct HashTransparent: integral_constant<bool, HashHasTransparent<Hash>::value && HashHasTransparent<KeyEqual>::value> {};
+
+    // Open-addressing hash table in the Swiss table layout, shared by
+    // ft::unordered_map and ft::unordered_set.
+    //
+    // The table has capacity = 2^k - 1 slots and capacity + 16 control bytes:
+    // one per slot, a sentinel that stops iteration, then a copy of the
+    // first 15 bytes so that a group load starting at any slot stays in
+    // bounds. Probing walks whole groups in a triangular sequence and ends at
+    // the first group holding an empty byte. Erased slots become tombstones
+    // unless no probe sequence can have passed through them.
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    class HashTable
+    {
+        public:
+            typedef Key                                 key_type;
+            typedef Value                               value_type;
+            typedef Hash                                hasher;
+            typedef KeyEqual                            key_equal;
+            typedef Alloc                               allocator_type;
+            typedef value_type&                         reference;
+            typedef const value_type&                   const_reference;
+            typedef value_type*                         pointer;
+            typedef const value_type*                   const_pointer;
+            typedef std::size_t                         size_type;
+            typedef std::ptrdiff_t                      difference_type;
+
+            typedef HashIterator<value_type>            iterator;
+            typedef HashIterator<const value_type>      const_iterator;
+
+        private:
+            typedef typename RebindAlloc<Alloc, signed char>::type   ctrl_allocator_type;
+
+            allocator_type          alloc;
+            ctrl_allocator_type     ctrlAlloc;
+            hasher                  hash;
+            key_equal               equal;
+            signed char             *ctrl;
+            value_type              *slots;
+            size_type               capacity;
+            size_type               length;
+            size_type               growthLeft;
+            float                   maxLoad;
+
+        public:
+            HashTable( size_type buckets, const Hash& hash, const KeyEqual& equal, const Alloc& alloc );
+            HashTable( const HashTable &other );
+            ~HashTable();
+
+            HashTable &operator=(const HashTable &other);
+
+# if __cplusplus >= 201103L
+            HashTable( HashTable &&other );
+            HashTable &operator=(HashTable &&other);
+# endif
+
+            //Iterators
+            iterator                begin() { return this->capacity ? this->iteratorAt(0).skipEmpty() : this->end(); }
+            const_iterator          begin() const { return this->capacity ? this->iteratorAt(0).skipEmpty() : this->end(); }
+            iterator                end() { return this->iteratorAt(this->capacity); }
+            const_iterator          end() const { return this->iteratorAt(this->capacity); }
+
+            //Capacity
+            bool        empty() const { return (this->length == 0); }
+            size_type   size() const { return this->length; }
+            size_type   max_size() const { return (std::numeric_limits<size_type>::max() / (sizeof(value_type) + 1)); }
+
+            //Modifiers
+            pair<iterator, bool>    insert(const value_type &value);
+            iterator                insert(const_iterator, const value_type &value) { return this->insert(value).first; }
+            void                    erase(const_iterator position);
+            size_type               erase(const key_type &key);
+            void                    erase(const_iterator first, const_iterator last);
+            void                    clear();
+
+# if __cplusplus >= 201103L
+            pair<iterator, bool>    insert(value_type &&value);
+            template <class... Args>
+            pair<iterator, bool>    emplace(Args&&... args)
+            {
+                value_type  value(std::forward<Args>(args)...);
+
+                return this->insert(std::move(value));
+            }
+# endif
+
+            template <class InputIterator>
+            void insert(InputIterator first, InputIterator last)
+            {
+                for (; first != last; ++first)
+                    this->insert(*first);
+            }
+
+            //Lookup
+            iterator                find(const key_type &key) { return this->iteratorAt(this->findIndex(key)); }
+            const_iterator          find(const key_type &key) const { return this->iteratorAt(this->findIndex(key)); }
+            size_type               count(const key_type &key) const { return (this->findIndex(key) != this->capacity); }
+            pair<iterator, iterator>                equal_range(const key_type &key);
+            pair<const_iterator, const_iterator>    equal_range(const key_type &key) const;
+
+            template <class K>
+            typename enable_if<HashTransparent<Hash, KeyEqual, K>::value, iterator>::type
+            find(const K &key) { return this->iteratorAt(this->findIndex(key)); }
+
+            template <class K>
+            typename enable_if<HashTransparent<Hash, KeyEqual, K>::value, const_iterator>::type
+            find(const K &key) const { return this->iteratorAt(this->findIndex(key)); }
+
+            template <class K>
+            typename enable_if<HashTransparent<Hash, KeyEqual, K>::value, size_type>::type
+            count(const K &key) const { return (this->findIndex(key) != this->capacity); }
+
+            template <class K>
+            typename enable_if<HashTransparent<Hash, KeyEqual, K>::value, pair<iterator, iterator> >::type
+            equal_range(const K &key)
+            {
+                iterator    it = this->find(key);
+
+                return pair<iterator, iterator>(it, it == this->end() ? it : this->next(it));
+            }
+
+            template <class K>
+            typename enable_if<HashTransparent<Hash, KeyEqual, K>::value, pair<const_iterator, const_iterator> >::type
+            equal_range(const K &key) const
+            {
+                const_iterator  it = this->find(key);
+
+                return pair<const_iterator, const_iterator>(it, it == this->end() ? it : this->next(it));
+            }
+
+            //Bucket interface
+            size_type   bucket_count() const { return this->capacity; }
+            float       load_factor() const { return this->capacity ? static_cast<float>(this->length) / this->capacity : 0.0f; }
+            float       max_load_factor() const { return this->maxLoad; }
+            void        max_load_factor(float ml);
+            void        rehash(size_type buckets);
+            void        reserve(size_type n);
+
+            //Observers
+            hasher          hash_function() const { return this->hash; }
+            key_equal       key_eq() const { return this->equal; }
+            allocator_type  get_allocator() const { return this->alloc; }
+
+        protected:
+            void        swapTable(HashTable &x);
+            value_type  *slotAt(size_type i) { return this->slots + i; }
+            template <class V>
+            void        constructAt(size_type i, V &value) { allocConstruct(this->alloc, this->slots + i, moveValue(value)); }
+            template <class K>
+            size_type   hashOf(const K &key) const { return hashMix(this->hash(key)); }
+
+            // Finds key; when absent, returns the free slot where it goes,
+            // growing the table first if needed. The caller constructs the
+            // value there, then calls commitInsert.
+            template <class K>
+            pair<size_type, bool>   findOrPrepareInsert(const K &key, size_type hash);
+            void                    commitInsert(size_type i, size_type hash);
+
+        private:
+            iterator        iteratorAt(size_type i) { return iterator(this->ctrl + i, this->slots + i); }
+            const_iterator  iteratorAt(size_type i) const { return const_iterator(this->ctrl + i, this->slots + i); }
+            size_type       indexOf(const_iterator it) const { return it.slotBase() - this->slots; }
+            template <class It>
+            It              next(It it) const { return ++it; }
+
+            static signed char  h2(size_type hash) { return static_cast<signed char>(hash & 0x7F); }
+            static size_type    h1(size_type hash) { return hash >> 7; }
+
+            template <class K>
+            size_type       findIndex(const K &key) const { return this->findIndex(key, this->hashOf(key)); }
+            template <class K>
+            size_type       findIndex(const K &key, size_type hash) const;
+            size_type       findFirstNonFull(size_type hash) const;
+            void            setCtrl(size_type i, signed char c);
+            size_type       growthLimit(size_type cap) const;
+            size_type       capacityFor(size_type n) const;
+            void            allocateTable(size_type cap);
+            void            destroyValues();
+            void            deallocateTable();
+            void            resize(size_type cap);
+            template <class V>
+            pair<iterator, bool>    insertUnique(V &value);
+    };
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::HashTable(size_type buckets, const Hash& hash, const KeyEqual& equal, const Alloc& alloc):
+        alloc(alloc), ctrlAlloc(alloc), hash(hash), equal(equal), ctrl(NULL), slots(NULL), capacity(0), length(0), growthLeft(0), maxLoad(0.875f)
+    {
+        if (buckets)
+            this->rehash(buckets);
+    }
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::HashTable(const HashTable &other):
+        alloc(other.alloc), ctrlAlloc(other.ctrlAlloc), hash(other.hash), equal(other.equal), ctrl(NULL), slots(NULL), capacity(0), length(0), growthLeft(0), maxLoad(other.maxLoad)
+    {
+        *this = other;
+    }
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::~HashTable()
+    {
+        this->destroyValues();
+        this->deallocateTable();
+    }
+
+    // Copies slot by slot, tombstones included, into a table of the same
+    // capacity, so no key is hashed again and every probe sequence holds.
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc> &HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::operator=(const HashTable &other)
+    {
+        if (this == &other)
+            return *this;
+        this->destroyValues();
+        this->deallocateTable();
+        this->hash = other.hash;
+        this->equal = other.equal;
+        this->maxLoad = other.maxLoad;
+        if (other.capacity == 0)
+            return *this;
+        this->allocateTable(other.capacity);
+        for (size_type i = 0; i < other.capacity; i++)
+        {
+            if (other.ctrl[i] >= 0)
+            {
+                allocConstruct(this->alloc, this->slots + i, other.slots[i]);
+                this->length++;
+            }
+            this->setCtrl(i, other.ctrl[i]);
+        }
+        this->growthLeft = other.growthLeft;
+        return *this;
+    }
+
+# if __cplusplus >= 201103L
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::HashTable(HashTable &&other):
+        alloc(other.alloc), ctrlAlloc(other.ctrlAlloc), hash(other.hash), equal(other.equal), ctrl(NULL), slots(NULL), capacity(0), length(0), growthLeft(0), maxLoad(other.maxLoad)
+    {
+        this->swapTable(other);
+    }
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc> &HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::operator=(HashTable &&other)
+    {
+        if (this != &other)
+        {
+            this->clear();
+            this->deallocateTable();
+            this->swapTable(other);
+        }
+        return *this;
+    }
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    pair<typename HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::iterator, bool> HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::insert(value_type &&value)
+    {
+        return this->insertUnique(value);
+    }
+# endif
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    pair<typename HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::iterator, bool> HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::insert(const value_type &value)
+    {
+        return this->insertUnique(value);
+    }
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    template <class V>
+    pair<typename HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::iterator, bool> HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::insertUnique(V &value)
+    {
+        size_type               hash = this->hashOf(KeyOf()(value));
+        pair<size_type, bool>   pos = this->findOrPrepareInsert(KeyOf()(value), hash);
+
+        if (pos.second)
+        {
+            allocConstruct(this->alloc, this->slots + pos.first, moveValue(value));
+            this->commitInsert(pos.first, hash);
+        }
+        return pair<iterator, bool>(this->iteratorAt(pos.first), pos.second);
+    }
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    template <class K>
+    pair<typename HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::size_type, bool> HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::findOrPrepareInsert(const K &key, size_type hash)
+    {
+        size_type   found = this->findIndex(key, hash);
+        size_type   i;
+
+        if (found != this->capacity)
+            return pair<size_type, bool>(found, false);
+        if (this->capacity == 0)
+            this->resize(this->capacityFor(1));
+        i = this->findFirstNonFull(hash);
+        if (this->growthLeft == 0 && this->ctrl[i] != HashCtrl::deleted)
+        {
+            this->resize(this->capacityFor(this->length + 1));
+            i = this->findFirstNonFull(hash);
+        }
+        return pair<size_type, bool>(i, true);
+    }
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    void HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::commitInsert(size_type i, size_type hash)
+    {
+        if (this->ctrl[i] == HashCtrl::empty)
+            this->growthLeft--;
+        this->setCtrl(i, h2(hash));
+        this->length++;
+    }
+
+    // The slot goes back to empty when the groups around it had an empty
+    // byte within 16 positions on both sides: no probe can have seen a full
+    // group there, so none relies on this slot to keep going.
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    void HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::erase(const_iterator position)
+    {
+        size_type   i = this->indexOf(position);
+        size_type   before = (i - HashGroup::width) & this->capacity;
+        unsigned    emptyAfter = HashGroup(this->ctrl + i).matchEmpty();
+        unsigned    emptyBefore = HashGroup(this->ctrl + before).matchEmpty();
+
+        allocDestroy(this->alloc, this->slots + i);
+        this->length--;
+        if (emptyBefore && emptyAfter && hashTrailingZeros(emptyAfter) + hashLeadingZeros16(emptyBefore) < HashGroup::width)
+        {
+            this->setCtrl(i, HashCtrl::empty);
+            this->growthLeft++;
+        }
+        else
+            this->setCtrl(i, HashCtrl::deleted);
+    }
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    typename HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::size_type HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::erase(const key_type &key)
+    {
+        size_type   i = this->findIndex(key);
+
+        if (i == this->capacity)
+            return (0);
+        this->erase(this->iteratorAt(i));
+        return (1);
+    }
+
+    // Erasing never moves other values, so the slots after first stay put.
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    void HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::erase(const_iterator first, const_iterator last)
+    {
+        while (first != last)
+        {
+            const_iterator  current = first;
+
+            ++first;
+            this->erase(current);
+        }
+    }
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    void HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::clear()
+    {
+        if (this->capacity == 0)
+            return;
+        this->destroyValues();
+        std::memset(this->ctrl, HashCtrl::empty, this->capacity + HashGroup::width);
+        this->ctrl[this->capacity] = HashCtrl::sentinel;
+        this->length = 0;
+        this->growthLeft = this->growthLimit(this->capacity);
+    }
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    pair<typename HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::iterator, typename HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::iterator>
+    HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::equal_range(const key_type &key)
+    {
+        iterator    it = this->find(key);
+
+        return pair<iterator, iterator>(it, it == this->end() ? it : this->next(it));
+    }
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    pair<typename HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::const_iterator, typename HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::const_iterator>
+    HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::equal_range(const key_type &key) const
+    {
+        const_iterator  it = this->find(key);
+
+        return pair<const_iterator, const_iterator>(it, it == this->end() ? it : this->next(it));
+    }
+
+    // Load factors close to 1 make probes long and must leave one empty slot
+    // for lookups to stop on, so the value is clamped to [0.25, 0.9375].
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    void HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::max_load_factor(float ml)
+    {
+        this->maxLoad = std::min(std::max(ml, 0.25f), 0.9375f);
+        if (this->capacity)
+            this->resize(std::max(this->capacity, this->capacityFor(this->length)));
+    }
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    void HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::rehash(size_type buckets)
+    {
+        size_type   cap = this->capacityFor(this->length);
+
+        while (cap < buckets)
+            cap = cap * 2 + 1;
+        if (buckets == 0 && this->length == 0)
+        {
+            this->deallocateTable();
+            return;
+        }
+        this->resize(cap);
+    }
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    void HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::reserve(size_type n)
+    {
+        if (n > this->length + this->growthLeft || this->capacity == 0)
+            this->resize(std::max(this->capacity, this->capacityFor(n)));
+    }
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    void HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::swapTable(HashTable &x)
+    {
+        std::swap(this->alloc, x.alloc);
+        std::swap(this->ctrlAlloc, x.ctrlAlloc);
+        std::swap(this->hash, x.hash);
+        std::swap(this->equal, x.equal);
+        std::swap(this->ctrl, x.ctrl);
+        std::swap(this->slots, x.slots);
+        std::swap(this->capacity, x.capacity);
+        std::swap(this->length, x.length);
+        std::swap(this->growthLeft, x.growthLeft);
+        std::swap(this->maxLoad, x.maxLoad);
+    }
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    template <class K>
+    typename HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::size_type HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::findIndex(const K &key, size_type hash) const
+    {
+        if (this->capacity == 0)
+            return (0);
+
+        size_type   offset = h1(hash) & this->capacity;
+        size_type   index = 0;
+        signed char tag = h2(hash);
+
+        while (true)
+        {
+            HashGroup   group(this->ctrl + offset);
+
+            for (unsigned match = group.match(tag); match; match &= match - 1)
+            {
+                size_type   i = (offset + hashTrailingZeros(match)) & this->capacity;
+
+                if (this->equal(KeyOf()(this->slots[i]), key))
+                    return i;
+            }
+            if (group.matchEmpty())
+                return this->capacity;
+            index += HashGroup::width;
+            offset = (offset + index) & this->capacity;
+        }
+    }
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    typename HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::size_type HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::findFirstNonFull(size_type hash) const
+    {
+        size_type   offset = h1(hash) & this->capacity;
+        size_type   index = 0;
+
+        while (true)
+        {
+            unsigned    mask = HashGroup(this->ctrl + offset).matchEmptyOrDeleted();
+
+            if (mask)
+                return (offset + hashTrailingZeros(mask)) & this->capacity;
+            index += HashGroup::width;
+            offset = (offset + index) & this->capacity;
+        }
+    }
+
+    // Writes a control byte and its mirror after the sentinel.
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    void HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::setCtrl(size_type i, signed char c)
+    {
+        this->ctrl[i] = c;
+        this->ctrl[((i - (HashGroup::width - 1)) & this->capacity) + (HashGroup::width - 1)] = c;
+    }
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    typename HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::size_type HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::growthLimit(size_type cap) const
+    {
+        return std::min(cap - 1, static_cast<size_type>(cap * this->maxLoad));
+    }
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    typename HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::size_type HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::capacityFor(size_type n) const
+    {
+        size_type   cap = HashGroup::width - 1;
+
+        while (this->growthLimit(cap) < n)
+            cap = cap * 2 + 1;
+        return cap;
+    }
+
+    // Installs an empty table of cap slots. Both blocks are allocated before
+    // any member changes, so a failure leaves the current table in place.
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    void HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::allocateTable(size_type cap)
+    {
+        value_type  *newSlots = this->alloc.allocate(cap);
+        signed char *newCtrl;
+
+        try
+        {
+            newCtrl = this->ctrlAlloc.allocate(cap + HashGroup::width);
+        }
+        catch (...)
+        {
+            this->alloc.deallocate(newSlots, cap);
+            throw;
+        }
+        std::memset(newCtrl, HashCtrl::empty, cap + HashGroup::width);
+        newCtrl[cap] = HashCtrl::sentinel;
+        this->slots = newSlots;
+        this->ctrl = newCtrl;
+        this->capacity = cap;
+        this->length = 0;
+        this->growthLeft = this->growthLimit(cap);
+    }
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    void HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::destroyValues()
+    {
+        for (size_type i = 0; i < this->capacity; i++)
+            if (this->ctrl[i] >= 0)
+                allocDestroy(this->alloc, this->slots + i);
+    }
+
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    void HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::deallocateTable()
+    {
+        if (this->capacity == 0)
+            return;
+        this->ctrlAlloc.deallocate(this->ctrl, this->capacity + HashGroup::width);
+        this->alloc.deallocate(this->slots, this->capacity);
+        this->ctrl = NULL;
+        this->slots = NULL;
+        this->capacity = 0;
+        this->length = 0;
+        this->growthLeft = 0;
+    }
+
+    // Rebuilds the table with cap slots, relocating every value to its new
+    // position; tombstones are dropped on the way.
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+    void HashTable<Value, Key, KeyOf, Hash, KeyEqual, Alloc>::resize(size_type cap)
+    {
+        signed char *oldCtrl = this->ctrl;
+        value_type  *oldSlots = this->slots;
+        size_type   oldCapacity = this->capacity;
+        size_type   oldLength = this->length;
+
+        this->allocateTable(cap);
+        for (size_type i = 0; i < oldCapacity; i++)
+        {
+            if (oldCtrl[i] >= 0)
+            {
+                size_type   hash = this->hashOf(KeyOf()(oldSlots[i]));
+                size_type   j = this->findFirstNonFull(hash);
+
+                this->setCtrl(j, h2(hash));
+                relocate(this->alloc, oldSlots + i, oldSlots + i + 1, this->slots + j);
+            }
+        }
+        this->length = oldLength;
+        this->growthLeft -= oldLength;
+        if (oldCapacity)
+        {
+            this->ctrlAlloc.deallocate(oldCtrl, oldCapacity + HashGroup::width);
+            this->alloc.deallocate(oldSlots, oldCapacity);
+        }
+    }
+
+}
+
+#endif
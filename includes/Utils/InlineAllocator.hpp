@@ -0,0 +1,98 @@
+#ifndef FT_INLINE_ALLOCATOR_HPP
+# define FT_INLINE_ALLOCATOR_HPP
+
+# include <cstddef>
+# include <memory>
+# include <new>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+# include "AllocTraits.hpp"
+# include "AlignedStorage.hpp"
+
+namespace ft
+{
+
+    // Allocator of ft::small_vector. It embeds storage for N objects and hands
+    // it out for the first request of at most N objects while it is free;
+    // every other request goes to Alloc. Since the container stores its
+    // allocator by value, the buffer lives inside the container itself.
+    //
+    // Copies get their own, unused buffer and assignment keeps the current
+    // one: the buffer belongs to the object, never to its value.
+    template<class T, std::size_t N, class Alloc = std::allocator<T> >
+    class InlineAllocator
+    {
+        public:
+            typedef T                   value_type;
+            typedef T                   *pointer;
+            typedef const T             *const_pointer;
+            typedef T                   &reference;
+            typedef const T             &const_reference;
+            typedef std::size_t         size_type;
+            typedef std::ptrdiff_t      difference_type;
+
+            template<class U>
+            struct rebind
+            {
+                typedef InlineAllocator<U, N, typename RebindAlloc<Alloc, U>::type>  other;
+            };
+
+        private:
+            Alloc                   alloc;
+            bool                    inUse;
+            AlignedStorage<T, N>    storage;
+
+        public:
+            InlineAllocator(): alloc(), inUse(false) {}
+            explicit InlineAllocator(const Alloc &a): alloc(a), inUse(false) {}
+            InlineAllocator(const InlineAllocator &other): alloc(other.alloc), inUse(false) {}
+            ~InlineAllocator() {}
+
+            InlineAllocator &operator=(const InlineAllocator &other)
+            {
+                this->alloc = other.alloc;
+                return *this;
+            }
+
+            pointer         buffer() { return this->storage.data(); }
+            const_pointer   buffer() const { return this->storage.data(); }
+            const Alloc     &base() const { return this->alloc; }
+
+            pointer         address(reference x) const { return &x; }
+            const_pointer   address(const_reference x) const { return &x; }
+            size_type       max_size() const { return allocMaxSize(this->alloc); }
+
+            pointer     allocate(size_type n, const void * = 0)
+            {
+                if (!this->inUse && n <= N)
+                {
+                    this->inUse = true;
+                    return this->buffer();
+                }
+                return this->alloc.allocate(n);
+            }
+
+            void        deallocate(pointer p, size_type n)
+            {
+                if (p == this->buffer())
+                    this->inUse = false;
+                else
+                    this->alloc.deallocate(p, n);
+            }
+
+# if __cplusplus >= 201103L
+            template<class U, class... Args>
+            void        construct(U *p, Args&&... args) { new (p) U(std::forward<Args>(args)...); }
+# else
+            void        construct(pointer p, const_reference val) { new (p) T(val); }
+# endif
+            void        destroy(pointer p) { p->~T(); }
+
+            bool    operator==(const InlineAllocator &other) const { return this == &other; }
+            bool    operator!=(const InlineAllocator &other) const { return this != &other; }
+    };
+
+}
+
+#endif
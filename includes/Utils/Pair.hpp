@@ -1,6 +1,12 @@
 #ifndef FT_PAIR_HPP
 # define FT_PAIR_HPP
 
+# if __cplusplus >= 201103L
+#  include <utility>
+#  include <type_traits>
+# endif
+# include "TypeTraits.hpp"
+
 namespace ft
 {
 
@@ -15,6 +21,7 @@ namespace ft
 
         pair(): first(), second() {}
         pair(const T1 &x, const T2 &y): first(x), second(y) {}
+        pair(const pair &p): first(p.first), second(p.second) {}
         template<class U1, class U2>
         pair(const pair<U1, U2> &p): first(p.first), second(p.second) {}
 
@@ -24,11 +31,32 @@ namespace ft
             this->second = other.second;
             return *this;
         }
+
+# if __cplusplus >= 201103L
+        // Only takes part when both arguments convert, as std::pair does.
+        template<class U1, class U2, class = typename enable_if<
+            std::is_convertible<U1, T1>::value && std::is_convertible<U2, T2>::value>::type>
+        pair(U1 &&x, U2 &&y): first(std::forward<U1>(x)), second(std::forward<U2>(y)) {}
+        pair(pair &&p): first(std::move(p.first)), second(std::move(p.second)) {}
+        template<class U1, class U2>
+        pair(pair<U1, U2> &&p): first(std::move(p.first)), second(std::move(p.second)) {}
+
+        pair &operator=(pair &&other)
+        {
+            this->first = std::move(other.first);
+            this->second = std::move(other.second);
+            return *this;
+        }
+# endif
     };
 
     template<class T1, class T2>
     pair<T1, T2>    make_pair(T1 x, T2 y) { return pair<T1, T2>(x, y); }
 
+    template<class T1, class T2>
+    struct is_trivially_relocatable< pair<T1, T2> >:
+        integral_constant<bool, is_trivially_relocatable<T1>::value && is_trivially_relocatable<T2>::value> {};
+
     template<class T1, class T2>
     bool    operator==(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs)
     {
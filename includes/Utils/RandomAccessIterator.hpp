@@ -2,6 +2,7 @@
 # define RANDOM_ACCESS_ITERATOR_HPP
 
 #include <memory>
+#include <cstddef>
 
 namespace ft
 {
@@ -64,16 +65,14 @@ namespace ft
                 return *this;
             }
 
-            iterator    operator+(size_type n)
+            iterator    operator+(size_type n) const
             {
-                this->ptr = this->ptr + n;
-                return this;
+                return iterator(this->ptr + n);
             }
 
-            iterator    operator-(size_type n)
+            iterator    operator-(size_type n) const
             {
-                this->ptr = this->ptr - n;
-                return this;
+                return iterator(this->ptr - n);
             }
 
             size_type   operator-(iterator it)
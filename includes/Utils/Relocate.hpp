@@ -0,0 +1,96 @@
+#ifndef FT_RELOCATE_HPP
+# define FT_RELOCATE_HPP
+
+# include <cstddef>
+# include <cstring>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+# include "TypeTraits.hpp"
+# include "AllocTraits.hpp"
+
+namespace ft
+{
+
+    // Source of an element that is about to be destroyed: moved from when the
+    // language allows it, copied from otherwise.
+# if __cplusplus >= 201103L
+    template<class T>
+    T       &&moveValue(T &x) { return std::move(x); }
+# else
+    template<class T>
+    const T &moveValue(T &x) { return x; }
+# endif
+
+    // Moves [first, last) to the uninitialized range starting at dest and leaves
+    // the source uninitialized. The ranges may overlap in either direction.
+    template<bool Trivial>
+    struct Relocator
+    {
+        template<class Alloc, class T>
+        static void     relocate(Alloc &alloc, T *first, T *last, T *dest)
+        {
+            if (dest < first)
+            {
+                for (; first != last; first++, dest++)
+                {
+                    allocConstruct(alloc, dest, moveValue(*first));
+                    allocDestroy(alloc, first);
+                }
+            }
+            else if (dest > first)
+            {
+                dest += last - first;
+                while (last != first)
+                {
+                    allocConstruct(alloc, --dest, moveValue(*--last));
+                    allocDestroy(alloc, last);
+                }
+            }
+        }
+    };
+
+    template<>
+    struct Relocator<true>
+    {
+        template<class Alloc, class T>
+        static void     relocate(Alloc &, T *first, T *last, T *dest)
+        {
+            if (first != last && dest != first)
+                std::memmove(static_cast<void *>(dest), static_cast<const void *>(first), (last - first) * sizeof(T));
+        }
+    };
+
+    template<class Alloc, class T>
+    void    relocate(Alloc &alloc, T *first, T *last, T *dest)
+    {
+        Relocator<is_trivially_relocatable<T>::value>::relocate(alloc, first, last, dest);
+    }
+
+    // Allocators that can resize a block while keeping its bytes (mremap
+    // and the like) opt in here and provide
+    //     pointer reallocate(pointer p, size_type oldN, size_type newN);
+    // Containers only use it for trivially relocatable elements.
+    template<class Alloc>
+    struct has_reallocate: false_type {};
+
+    template<bool Reallocates>
+    struct BufferReallocator
+    {
+        template<class Alloc, class T>
+        static T    *reallocate(Alloc &, T *, std::size_t, std::size_t) { return NULL; }
+    };
+
+    template<>
+    struct BufferReallocator<true>
+    {
+        template<class Alloc, class T>
+        static T    *reallocate(Alloc &alloc, T *p, std::size_t oldN, std::size_t newN)
+        {
+            return alloc.reallocate(p, oldN, newN);
+        }
+    };
+
+}
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef FT_SORTED_UNIQUE_HPP
+# define FT_SORTED_UNIQUE_HPP
+
+namespace ft
+{
+
+    // Tag for constructors and inserts whose input is already sorted by key
+    // and free of duplicates, so that the containers can skip the checks.
+    struct sorted_unique_t {};
+    static const sorted_unique_t    sorted_unique = sorted_unique_t();
+
+}
+
+#endif
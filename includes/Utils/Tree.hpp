@@ -2,18 +2,42 @@
 # define TREE_HPP
 
 # include "Pair.hpp"
+# include <cstddef>
 # include <cstdlib>
+# include <new>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
 
 namespace ft
 {
 
     typedef size_t      size_type;
 
-    template<class T>
-    struct TreeNode
+    struct emplace_tag {};
+
+    // Node layout policies. order_statistic_policy adds a subtree size to
+    // every node so that rank/select queries run in O(log n).
+    struct plain_tree_policy {};
+    struct order_statistic_policy {};
+
+    template<class Policy>
+    struct TreeNodeBase {};
+
+    template<>
+    struct TreeNodeBase<order_statistic_policy>
+    {
+        size_type       size;
+
+        TreeNodeBase(): size(1) {}
+    };
+
+    template<class T, class Policy = plain_tree_policy>
+    struct TreeNode: TreeNodeBase<Policy>
     {
         typedef T           value_type;
-        
+        typedef Policy      policy_type;
+
         value_type      value;
         TreeNode        *left;
         TreeNode        *right;
@@ -21,7 +45,7 @@ namespace ft
         size_type       height;
         bool            end;
 
-        TreeNode(T val, bool isEnd = false): value(val)
+        TreeNode(const T &val, bool isEnd = false): value(val)
         {
             left = NULL;
             right = NULL;
@@ -29,54 +53,189 @@ namespace ft
             height = 1;
             end = isEnd;
         }
+
+# if __cplusplus >= 201103L
+        template<class... Args>
+        TreeNode(emplace_tag, Args&&... args): value(std::forward<Args>(args)...)
+        {
+            left = NULL;
+            right = NULL;
+            parent = NULL;
+            height = 1;
+            end = false;
+        }
+# endif
     };
     
+    template<class NodeAlloc>
+    typename NodeAlloc::value_type  *createNode(NodeAlloc &alloc, const typename NodeAlloc::value_type::value_type &value, bool isEnd = false)
+    {
+        typedef typename NodeAlloc::value_type  node_type;
+
+        node_type   *node = alloc.allocate(1);
+
+        try
+        {
+            new (node) node_type(value, isEnd);
+        }
+        catch (...)
+        {
+            alloc.deallocate(node, 1);
+            throw;
+        }
+        return node;
+    }
+
+# if __cplusplus >= 201103L
+    template<class NodeAlloc, class... Args>
+    typename NodeAlloc::value_type  *emplaceNode(NodeAlloc &alloc, Args&&... args)
+    {
+        typedef typename NodeAlloc::value_type  node_type;
+
+        node_type   *node = alloc.allocate(1);
+
+        try
+        {
+            new (node) node_type(emplace_tag(), std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            alloc.deallocate(node, 1);
+            throw;
+        }
+        return node;
+    }
+# endif
+
+    template<class T, class P, class NodeAlloc>
+    void    destroyNode(NodeAlloc &alloc, TreeNode<T, P> *node)
+    {
+        node->~TreeNode();
+        alloc.deallocate(node, 1);
+    }
+
+    // Post-order free of a whole subtree, no rebalancing; returns the number
+    // of nodes released.
+    template<class T, class P, class NodeAlloc>
+    size_type   destroyTree(TreeNode<T, P> *node, NodeAlloc &alloc)
+    {
+        if (!node || node->end)
+            return 0;
+        size_type   count = destroyTree(node->left, alloc);
+
+        count += destroyTree(node->right, alloc);
+        destroyNode(alloc, node);
+        return count + 1;
+    }
+
+    template<class T, class P, class NodeAlloc>
+    TreeNode<T, P>    *cloneTree(const TreeNode<T, P> *node, TreeNode<T, P> *parent, NodeAlloc &alloc)
+    {
+        if (!node || node->end)
+            return NULL;
+        TreeNode<T, P> *copy = createNode(alloc, node->value);
+
+        copy->parent = parent;
+        try
+        {
+            copy->left = cloneTree(node->left, copy, alloc);
+            copy->right = cloneTree(node->right, copy, alloc);
+        }
+        catch (...)
+        {
+            destroyTree(copy, alloc);
+            throw;
+        }
+        fixHeight(copy);
+        return copy;
+    }
+
+    template<class T, class P>
+    size_type   height(TreeNode<T, P> *node)
+    {
+        return (node && !node->end) ? node->height : 0;
+    }
+
+    template<class Node>
+    size_type   subtreeSize(Node *node)
+    {
+        return (node && !node->end) ? node->size : 0;
+    }
+
     template<class T>
-    size_type   height(TreeNode<T> *node)
+    void    fixSize(TreeNode<T, plain_tree_policy> *)
     {
-        return node ? node->height : 0;
     }
 
     template<class T>
-    int     bfactor(TreeNode<T> *node)
+    void    fixSize(TreeNode<T, order_statistic_policy> *node)
+    {
+        node->size = subtreeSize(node->left) + subtreeSize(node->right) + 1;
+    }
+
+    // Finishes the size update on the path to the root once rebalancing has
+    // stopped early.
+    template<class T>
+    void    fixSizesUp(TreeNode<T, plain_tree_policy> *)
     {
-        return height(node->right) - height(node->left); 
     }
 
     template<class T>
-    void    fixHeight(TreeNode<T> *node)
+    void    fixSizesUp(TreeNode<T, order_statistic_policy> *node)
+    {
+        for (; node; node = node->parent)
+            fixSize(node);
+    }
+
+    template<class T, class P>
+    int     bfactor(TreeNode<T, P> *node)
+    {
+        return height(node->right) - height(node->left); 
+    }
+
+    template<class T, class P>
+    void    fixHeight(TreeNode<T, P> *node)
     {
         size_type   hl = height(node->left);
         size_type   hr = height(node->right);
-        node->height = (hl < hr ? hl : hr) + 1;
+        node->height = (hl > hr ? hl : hr) + 1;
+        fixSize(node);
     }
 
-    template<class T>
-    TreeNode<T>    *rotateRight(TreeNode<T> *node)
+    template<class T, class P>
+    TreeNode<T, P>    *rotateRight(TreeNode<T, P> *node)
     {
-        TreeNode<T> *q = node->left;
+        TreeNode<T, P> *q = node->left;
         node->left = q->right;
+        if (node->left)
+            node->left->parent = node;
         q->right = node;
+        q->parent = node->parent;
+        node->parent = q;
         fixHeight(node);
         fixHeight(q);
 
         return q;
     }
 
-    template<class T>
-    TreeNode<T>    *rotateLeft(TreeNode<T> *node)
+    template<class T, class P>
+    TreeNode<T, P>    *rotateLeft(TreeNode<T, P> *node)
     {
-        TreeNode<T> *p = node->right;
+        TreeNode<T, P> *p = node->right;
         node->right = p->left;
+        if (node->right)
+            node->right->parent = node;
         p->left = node;
+        p->parent = node->parent;
+        node->parent = p;
         fixHeight(node);
         fixHeight(p);
 
         return p;
     }
 
-    template<class T>
-    TreeNode<T>    *balance(TreeNode<T> *node)
+    template<class T, class P>
+    TreeNode<T, P>    *balance(TreeNode<T, P> *node)
     {
         fixHeight(node);
         if (bfactor(node) == 2)
@@ -94,77 +253,438 @@ namespace ft
         return node;
     }
 
-    template<class T>
-    TreeNode<T>    *insertNode(TreeNode<T> *node, T value)
+    template<class T, class P>
+    TreeNode<T, P>    *balanceUp(TreeNode<T, P> *node, TreeNode<T, P> *root)
     {
-        if (!node)
-            return new TreeNode<T>(value);
-        if (value < node->value)
-            node->left = insertNode(node->left, value);
+        while (node)
+        {
+            TreeNode<T, P> *parent = node->parent;
+            bool        isLeft = parent && parent->left == node;
+            size_type   oldHeight = node->height;
+
+            node = balance(node);
+            if (!parent)
+                root = node;
+            else if (isLeft)
+                parent->left = node;
+            else
+                parent->right = node;
+            if (node->height == oldHeight)
+            {
+                fixSizesUp(parent);
+                break;
+            }
+            node = parent;
+        }
+
+        return root;
+    }
+
+    template<class T, class P, class Compare>
+    TreeNode<T, P>    *findInsertPos(TreeNode<T, P> *root, const T &value, Compare comp, TreeNode<T, P> *&parent, bool &isLeft)
+    {
+        TreeNode<T, P> *cur = root;
+
+        parent = NULL;
+        isLeft = false;
+        while (cur && !cur->end)
+        {
+            if (comp(value, cur->value))
+            {
+                parent = cur;
+                isLeft = true;
+                cur = cur->left;
+            }
+            else if (comp(cur->value, value))
+            {
+                parent = cur;
+                isLeft = false;
+                cur = cur->right;
+            }
+            else
+                return cur;
+        }
+
+        return NULL;
+    }
+
+    template<class T, class P>
+    void    linkNode(TreeNode<T, P> *&root, TreeNode<T, P> *parent, bool isLeft, TreeNode<T, P> *node)
+    {
+        TreeNode<T, P> *cur = NULL;
+
+        if (parent)
+            cur = isLeft ? parent->left : parent->right;
+        node->parent = parent;
+        if (cur)
+        {
+            cur->parent = node;
+            if (isLeft)
+                node->left = cur;
+            else
+                node->right = cur;
+        }
+        if (!parent)
+            root = node;
+        else if (isLeft)
+            parent->left = node;
         else
-            node->right = insertNode(node->right, value);
+            parent->right = node;
+        root = balanceUp(parent, root);
+    }
+
+    template<class T, class P, class Compare, class NodeAlloc>
+    pair<TreeNode<T, P>*, bool>    insertNode(TreeNode<T, P> *&root, const T &value, Compare comp, NodeAlloc &alloc)
+    {
+        TreeNode<T, P> *parent;
+        bool        isLeft;
+        TreeNode<T, P> *found = findInsertPos(root, value, comp, parent, isLeft);
 
-        return balance(node);
+        if (found)
+            return ft::make_pair(found, false);
+        TreeNode<T, P> *node = createNode(alloc, value);
+        linkNode(root, parent, isLeft, node);
+
+        return ft::make_pair(node, true);
     }
     
-    template<class T>
-    TreeNode<T>    *findMin(TreeNode<T> *node)
+    // Turns the first n nodes of a list chained through `right` into a
+    // perfectly balanced subtree and advances head past them.
+    template<class T, class P>
+    TreeNode<T, P>    *buildBalanced(TreeNode<T, P> *&head, size_type n)
+    {
+        if (n == 0)
+            return NULL;
+        TreeNode<T, P> *left = buildBalanced(head, n / 2);
+        TreeNode<T, P> *node = head;
+
+        head = head->right;
+        node->left = left;
+        if (left)
+            left->parent = node;
+        node->right = buildBalanced(head, n - n / 2 - 1);
+        if (node->right)
+            node->right->parent = node;
+        fixHeight(node);
+        return node;
+    }
+
+    template<class NodePtr>
+    NodePtr    *findMin(NodePtr *node)
     {
         return (node->left && !node->left->end) ? findMin(node->left) : node;
     }
 
-    template<class T>
-    TreeNode<T>    *findMax(TreeNode<T> *node)
+    template<class NodePtr>
+    NodePtr    *findMax(NodePtr *node)
     {
         return (node->right && !node->right->end) ? findMax(node->right) : node;
     }
 
-    template<class T>
-    TreeNode<T>    *removeMin(TreeNode<T> *node)
+    // Starts loading a node that a descent is about to visit. NULL is fine.
+    template<class NodePtr>
+    void    prefetchNode(NodePtr *node)
     {
-        if (node->left == NULL)
-            return node->right;
-        node->left = removeMin(node->left);
+# if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(node);
+# else
+        (void)node;
+# endif
+    }
+
+    // One step of a lower-bound descent: a single comparison, turned into
+    // selects rather than branches, so a random key costs no mispredicted
+    // jump per level.
+    template<class NodePtr, class Key, class Compare>
+    NodePtr    *lowerBoundStep(NodePtr *node, const Key &key, Compare comp, NodePtr *&candidate)
+    {
+        bool    goRight = comp(node->value.first, key);
 
-        return balance(node);
+        candidate = goRight ? candidate : node;
+        return goRight ? node->right : node->left;
     }
 
-    template<class T>
-    TreeNode<T>    *removeNode(TreeNode<T> *node, T value)
+    template<class T, class P>
+    void    replaceChild(TreeNode<T, P> *&root, TreeNode<T, P> *parent, TreeNode<T, P> *node, TreeNode<T, P> *child)
+    {
+        if (!parent)
+            root = child;
+        else if (parent->left == node)
+            parent->left = child;
+        else
+            parent->right = child;
+        if (child)
+            child->parent = parent;
+    }
+
+    template<class T, class P>
+    TreeNode<T, P>    *removeNode(TreeNode<T, P> *root, TreeNode<T, P> *node)
+    {
+        TreeNode<T, P> *parent = node->parent;
+        TreeNode<T, P> *from;
+
+        if (!node->left || !node->right)
+        {
+            replaceChild(root, parent, node, node->left ? node->left : node->right);
+            from = parent;
+        }
+        else
+        {
+            TreeNode<T, P> *min = findMin(node->right);
+            if (min->parent == node)
+                from = min;
+            else
+            {
+                from = min->parent;
+                replaceChild(root, min->parent, min, min->right);
+                min->right = node->right;
+                min->right->parent = min;
+            }
+            min->left = node->left;
+            min->left->parent = min;
+            min->height = node->height;
+            replaceChild(root, parent, node, min);
+        }
+
+        return balanceUp(from, root);
+    }
+
+    // Join primitives. All of them expect trees without end nodes attached
+    // and return a root whose parent is NULL.
+    template<class T, class P>
+    TreeNode<T, P>    *joinRight(TreeNode<T, P> *left, TreeNode<T, P> *mid, TreeNode<T, P> *right)
+    {
+        if (height(left->right) <= height(right) + 1)
+        {
+            mid->left = left->right;
+            mid->right = right;
+            if (mid->left)
+                mid->left->parent = mid;
+            if (right)
+                right->parent = mid;
+            fixHeight(mid);
+            left->right = mid;
+        }
+        else
+            left->right = joinRight(left->right, mid, right);
+        left->right->parent = left;
+        return balance(left);
+    }
+
+    template<class T, class P>
+    TreeNode<T, P>    *joinLeft(TreeNode<T, P> *left, TreeNode<T, P> *mid, TreeNode<T, P> *right)
+    {
+        if (height(right->left) <= height(left) + 1)
+        {
+            mid->left = left;
+            mid->right = right->left;
+            if (left)
+                left->parent = mid;
+            if (mid->right)
+                mid->right->parent = mid;
+            fixHeight(mid);
+            right->left = mid;
+        }
+        else
+            right->left = joinLeft(left, mid, right->left);
+        right->left->parent = right;
+        return balance(right);
+    }
+
+    // Every key of left < mid < every key of right; O(|h(left) - h(right)|).
+    template<class T, class P>
+    TreeNode<T, P>    *joinTrees(TreeNode<T, P> *left, TreeNode<T, P> *mid, TreeNode<T, P> *right)
+    {
+        TreeNode<T, P> *root;
+
+        if (height(left) > height(right) + 1)
+            root = joinRight(left, mid, right);
+        else if (height(right) > height(left) + 1)
+            root = joinLeft(left, mid, right);
+        else
+        {
+            mid->left = left;
+            mid->right = right;
+            if (left)
+                left->parent = mid;
+            if (right)
+                right->parent = mid;
+            fixHeight(mid);
+            root = mid;
+        }
+        root->parent = NULL;
+        return root;
+    }
+
+    // Same as joinTrees without a middle node: the maximum of left is taken
+    // out and used as the pivot.
+    template<class T, class P>
+    TreeNode<T, P>    *concatTrees(TreeNode<T, P> *left, TreeNode<T, P> *right)
+    {
+        if (!left || !right)
+        {
+            TreeNode<T, P> *root = left ? left : right;
+
+            if (root)
+                root->parent = NULL;
+            return root;
+        }
+        TreeNode<T, P> *mid = findMax(left);
+
+        left->parent = NULL;
+        left = removeNode(left, mid);
+        return joinTrees(left, mid, right);
+    }
+
+    // Splits node's subtree into the values ordered before value (left) and
+    // the others (right) in O(log n), reusing every node.
+    template<class T, class P, class Compare>
+    void    splitTree(TreeNode<T, P> *node, const T &value, Compare comp, TreeNode<T, P> *&left, TreeNode<T, P> *&right)
     {
         if (!node)
-            return NULL;
-        if (value < node->value)
-            node->left = removeNode(node->left, value);
-        else if (value > node->value)
-            node->right = removeNode(node->right, value);
+        {
+            left = NULL;
+            right = NULL;
+            return;
+        }
+        TreeNode<T, P> *l = node->left;
+        TreeNode<T, P> *r = node->right;
+
+        if (comp(node->value, value))
+        {
+            splitTree(r, value, comp, r, right);
+            left = joinTrees(l, node, r);
+        }
         else
         {
-            TreeNode<T> *left = node->left;
-            TreeNode<T> *right = node->right;
-            delete  node;
-            if (!right)
-                return left;
-            TreeNode<T> *min = findMin(right);
-            min->right = removeMin(right);
-            min->left = left;
-            return balance(min);
+            splitTree(l, value, comp, left, l);
+            right = joinTrees(l, node, r);
         }
+        if (left)
+            left->parent = NULL;
+        if (right)
+            right->parent = NULL;
+    }
 
-        return balance(node);
+    // Three-way split: the node equal to value, if any, is cut out on its own
+    // into found instead of going to either side.
+    template<class T, class P, class Compare>
+    void    splitTree(TreeNode<T, P> *node, const T &value, Compare comp, TreeNode<T, P> *&left, TreeNode<T, P> *&found, TreeNode<T, P> *&right)
+    {
+        if (!node)
+        {
+            left = NULL;
+            found = NULL;
+            right = NULL;
+            return;
+        }
+        TreeNode<T, P> *l = node->left;
+        TreeNode<T, P> *r = node->right;
+
+        if (comp(node->value, value))
+        {
+            splitTree(r, value, comp, r, found, right);
+            left = joinTrees(l, node, r);
+        }
+        else if (comp(value, node->value))
+        {
+            splitTree(l, value, comp, left, found, l);
+            right = joinTrees(l, node, r);
+        }
+        else
+        {
+            left = l;
+            right = r;
+            found = node;
+            found->left = NULL;
+            found->right = NULL;
+            fixHeight(found);
+        }
+        if (left)
+            left->parent = NULL;
+        if (right)
+            right->parent = NULL;
+        if (found)
+            found->parent = NULL;
     }
 
-    template<class T>
-    TreeNode<T>    *findAllParents(TreeNode<T> *node)
+    // Set operations after Blelloch et al., "Just Join for Parallel Ordered
+    // Sets": O(m log(n / m + 1)) for sizes m <= n, nodes are moved, never
+    // copied. Trees that get split must be free of end nodes; intersectTrees
+    // and subtractTrees only walk b, which may still carry them.
+
+    // Nodes of b whose key already exists in a end up, in order, in the list
+    // dups chained through `right` (the right half is processed first so that
+    // prepending keeps the list sorted).
+    template<class T, class P, class Compare>
+    TreeNode<T, P>    *unionTrees(TreeNode<T, P> *a, TreeNode<T, P> *b, Compare comp, TreeNode<T, P> *&dups, size_type &dupCount)
     {
-        if (node->left)
-            node->left->parent = node;
-            node->left = findAllParents(node->left);
-        if (node->right)
-            node->right->parent = node;
-            node->right = findAllParents(node->right);
-        
-        return node;
+        if (!a || !b)
+        {
+            TreeNode<T, P> *root = a ? a : b;
+
+            if (root)
+                root->parent = NULL;
+            return root;
+        }
+        TreeNode<T, P> *l;
+        TreeNode<T, P> *dup;
+        TreeNode<T, P> *r;
+        TreeNode<T, P> *al = a->left;
+        TreeNode<T, P> *ar = a->right;
+
+        splitTree(b, a->value, comp, l, dup, r);
+        r = unionTrees(ar, r, comp, dups, dupCount);
+        if (dup)
+        {
+            dup->right = dups;
+            dups = dup;
+            dupCount++;
+        }
+        l = unionTrees(al, l, comp, dups, dupCount);
+        return joinTrees(l, a, r);
+    }
+
+    template<class T, class P, class Compare, class NodeAlloc>
+    TreeNode<T, P>    *intersectTrees(TreeNode<T, P> *a, TreeNode<T, P> *b, Compare comp, NodeAlloc &alloc, size_type &removed)
+    {
+        if (!a)
+            return NULL;
+        if (!b || b->end)
+        {
+            removed += destroyTree(a, alloc);
+            return NULL;
+        }
+        TreeNode<T, P> *l;
+        TreeNode<T, P> *found;
+        TreeNode<T, P> *r;
+
+        splitTree(a, b->value, comp, l, found, r);
+        l = intersectTrees(l, b->left, comp, alloc, removed);
+        r = intersectTrees(r, b->right, comp, alloc, removed);
+        if (found)
+            return joinTrees(l, found, r);
+        return concatTrees(l, r);
+    }
+
+    template<class T, class P, class Compare, class NodeAlloc>
+    TreeNode<T, P>    *subtractTrees(TreeNode<T, P> *a, TreeNode<T, P> *b, Compare comp, NodeAlloc &alloc, size_type &removed)
+    {
+        if (!a || !b || b->end)
+            return a;
+        TreeNode<T, P> *l;
+        TreeNode<T, P> *found;
+        TreeNode<T, P> *r;
+
+        splitTree(a, b->value, comp, l, found, r);
+        if (found)
+        {
+            destroyNode(alloc, found);
+            removed++;
+        }
+        l = subtractTrees(l, b->left, comp, alloc, removed);
+        r = subtractTrees(r, b->right, comp, alloc, removed);
+        return concatTrees(l, r);
     }
 
     template<class NodePtr>
@@ -192,6 +712,114 @@ namespace ft
             x = x->parent;
         return x->parent;
     }
+
+    // Rank/select, order_statistic_policy only. End nodes count as the
+    // positions -1 (left) and size (right).
+    template<class NodePtr>
+    std::ptrdiff_t  nodeRank(NodePtr *x)
+    {
+        if (x->end && x->parent && isLeftChild(x))
+            return -1;
+        std::ptrdiff_t  rank = subtreeSize(x->left);
+
+        for (; x->parent; x = x->parent)
+        {
+            if (!isLeftChild(x))
+                rank += subtreeSize(x->parent->left) + 1;
+        }
+        return rank;
+    }
+
+    template<class NodePtr>
+    NodePtr    *selectNode(NodePtr *root, std::ptrdiff_t k)
+    {
+        if (k < 0)
+            return findMin(root)->left;
+        if (k >= static_cast<std::ptrdiff_t>(subtreeSize(root)))
+            return findMax(root)->right;
+        while (true)
+        {
+            std::ptrdiff_t  leftSize = subtreeSize(root->left);
+
+            if (k == leftSize)
+                return root;
+            if (k < leftSize)
+                root = root->left;
+            else
+            {
+                k -= leftSize + 1;
+                root = root->right;
+            }
+        }
+    }
+
+    template<class NodePtr>
+    NodePtr    *treeAdvance(NodePtr *x, std::ptrdiff_t n, plain_tree_policy)
+    {
+        for (; n > 0; n--)
+            x = treeNextIter(x);
+        for (; n < 0; n++)
+            x = treePrevIter(x);
+        return x;
+    }
+
+    template<class NodePtr>
+    NodePtr    *treeAdvance(NodePtr *x, std::ptrdiff_t n, order_statistic_policy)
+    {
+        NodePtr *root = x;
+
+        if (n == 0)
+            return x;
+        while (root->parent)
+            root = root->parent;
+        return selectNode(root, nodeRank(x) + n);
+    }
+
+    template<class NodePtr>
+    std::ptrdiff_t  treeDistance(NodePtr *first, NodePtr *last, plain_tree_policy)
+    {
+        std::ptrdiff_t  n = 0;
+
+        for (; first != last; first = treeNextIter(first))
+            n++;
+        return n;
+    }
+
+    template<class NodePtr>
+    std::ptrdiff_t  treeDistance(NodePtr *first, NodePtr *last, order_statistic_policy)
+    {
+        if (first == last)
+            return 0;
+        return nodeRank(last) - nodeRank(first);
+    }
+
+    // Elements from x to the right end in a tree of n elements, ends
+    // attached. The plain policy walks away from x both ways in step and
+    // stops at the nearer end: O(min(k, n - k) + log n).
+    template<class NodePtr>
+    size_type   treeCountFrom(NodePtr *x, size_type n, plain_tree_policy)
+    {
+        NodePtr     *up = x;
+        NodePtr     *down = x;
+        size_type   steps = 0;
+
+        while (true)
+        {
+            up = treeNextIter(up);
+            steps++;
+            if (up->end)
+                return steps;
+            down = treePrevIter(down);
+            if (down->end)
+                return n - (steps - 1);
+        }
+    }
+
+    template<class NodePtr>
+    size_type   treeCountFrom(NodePtr *x, size_type n, order_statistic_policy)
+    {
+        return n - nodeRank(x);
+    }
 }
 
 #endif
\ No newline at end of file
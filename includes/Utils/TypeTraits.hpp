@@ -0,0 +1,62 @@
+#ifndef FT_TYPE_TRAITS_HPP
+# define FT_TYPE_TRAITS_HPP
+
+# if __cplusplus >= 201103L
+#  include <type_traits>
+# endif
+
+namespace ft
+{
+
+    template<class T, T v>
+    struct integral_constant
+    {
+        typedef T                       value_type;
+        typedef integral_constant<T, v> type;
+
+        static const T  value = v;
+    };
+
+    typedef integral_constant<bool, true>   true_type;
+    typedef integral_constant<bool, false>  false_type;
+
+    template<bool B, class T = void>
+    struct enable_if {};
+
+    template<class T>
+    struct enable_if<true, T> { typedef T type; };
+
+    // Containers skip the destructor loop for these types. Clang deprecates
+    // __has_trivial_destructor, GCC before 14 lacks the newer builtin.
+    template<class T>
+# if __cplusplus >= 201103L
+    struct is_trivially_destructible: integral_constant<bool, std::is_trivially_destructible<T>::value> {};
+# elif defined(__clang__)
+    struct is_trivially_destructible: integral_constant<bool, __is_trivially_destructible(T)> {};
+# elif defined(__GNUC__)
+    struct is_trivially_destructible: integral_constant<bool, __has_trivial_destructor(T)> {};
+# else
+    struct is_trivially_destructible: false_type {};
+# endif
+
+    // A type is trivially relocatable when moving an object to new storage and
+    // forgetting the old bytes is the same as copy-constructing it there and
+    // destroying the original, so the containers may move it with memmove.
+    // Trivially copyable types qualify automatically; other types can opt in:
+    //     template<> struct ft::is_trivially_relocatable<MyType>: ft::true_type {};
+    template<class T>
+# if defined(__GNUC__) || defined(__clang__)
+    struct is_trivially_relocatable: integral_constant<bool, __is_trivially_copyable(T)> {};
+# else
+    struct is_trivially_relocatable: false_type {};
+# endif
+
+    template<class T>
+    struct is_trivially_relocatable<T*>: true_type {};
+
+    template<class T>
+    struct is_trivially_relocatable<const T>: is_trivially_relocatable<T> {};
+
+}
+
+#endif
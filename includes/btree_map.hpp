@@ -0,0 +1,922 @@
+#ifndef FT_BTREE_MAP_HPP
+# define FT_BTREE_MAP_HPP
+
+# include <memory>
+# include <new>
+# include <algorithm>
+# include <limits>
+# include <functional>
+# include <iterator>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+# include "Utils/Pair.hpp"
+# include "Utils/Relocate.hpp"
+# include "Utils/AllocTraits.hpp"
+# include "Utils/BTreeIterator.hpp"
+
+namespace ft
+{
+
+    // Ordered map with the interface of ft::map, stored in a B-tree whose
+    // nodes hold about NodeBytes bytes of values each. Lookups and scans touch
+    // far fewer cache lines than the AVL tree; in exchange insert and erase
+    // invalidate all iterators, as values move between nodes.
+    template<class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator< pair<const Key, T> >, std::size_t NodeBytes = 256 >
+    class btree_map
+    {
+        public:
+            typedef Key                         key_type;
+            typedef T                           mapped_type;
+            typedef pair<const Key, T>          value_type;
+            typedef Alloc                       allocator_type;
+            typedef Compare                     key_compare;
+            typedef value_type&                 reference;
+            typedef const value_type&           const_reference;
+            typedef value_type*                 pointer;
+            typedef const value_type*           const_pointer;
+            typedef std::size_t                 size_type;
+            typedef std::ptrdiff_t              difference_type;
+
+            static const size_type              slots = BTreeSlots<value_type, NodeBytes>::value;
+
+            typedef BTreeNode<value_type, slots>            node_type;
+            typedef BTreeInternalNode<value_type, slots>    internal_node_type;
+            typedef node_type*                              node;
+
+            typedef ft::BTreeIterator<node_type, value_type>        iterator;
+            typedef ft::BTreeIterator<node_type, const value_type>  const_iterator;
+            typedef std::reverse_iterator<iterator>                 reverse_iterator;
+            typedef std::reverse_iterator<const_iterator>           const_reverse_iterator;
+
+            class value_compare
+            {
+                friend class btree_map;
+
+                protected:
+                    Compare     comp;
+                    value_compare(Compare c) : comp(c) {}
+
+                public:
+                    typedef bool        result_type;
+                    typedef value_type  first_argument_type;
+                    typedef value_type  second_argument_type;
+
+                    bool operator() (const value_type &x, const value_type &y) const
+                    {
+                        return comp(x.first, y.first);
+                    }
+            };
+
+        private:
+            typedef typename RebindAlloc<Alloc, node_type>::type              leaf_allocator_type;
+            typedef typename RebindAlloc<Alloc, internal_node_type>::type     internal_allocator_type;
+
+            allocator_type          alloc;
+            leaf_allocator_type     leafAlloc;
+            internal_allocator_type internalAlloc;
+            key_compare             comp;
+            node                    root;
+            node                    leftmost;
+            node                    rightmost;
+            size_type               length;
+
+        public:
+            explicit btree_map( const Compare& comp = Compare(), const Alloc& alloc = Alloc() );
+            btree_map( const btree_map &other );
+
+            template< class InputIt >
+            btree_map( InputIt first, InputIt last, const Compare& comp = Compare(), const Alloc& alloc = Alloc() )
+            {
+                this->alloc = alloc;
+                this->leafAlloc = leaf_allocator_type(alloc);
+                this->internalAlloc = internal_allocator_type(alloc);
+                this->comp = comp;
+                this->root = NULL;
+                this->leftmost = NULL;
+                this->rightmost = NULL;
+                this->length = 0;
+                this->insert(first, last);
+            }
+
+            ~btree_map();
+
+            btree_map &operator=(const btree_map &other);
+
+# if __cplusplus >= 201103L
+            btree_map( btree_map &&other );
+            btree_map &operator=(btree_map &&other);
+# endif
+
+            //Iterators
+            iterator                begin() { return iterator(this->leftmost, 0); }
+            const_iterator          begin() const { return const_iterator(this->leftmost, 0); }
+            iterator                end() { return iterator(this->rightmost, this->rightmost ? this->rightmost->count : 0); }
+            const_iterator          end() const { return const_iterator(this->rightmost, this->rightmost ? this->rightmost->count : 0); }
+
+            reverse_iterator        rbegin() { return reverse_iterator(this->end()); }
+            const_reverse_iterator  rbegin() const { return const_reverse_iterator(this->end()); }
+            reverse_iterator        rend() { return reverse_iterator(this->begin()); }
+            const_reverse_iterator  rend() const { return const_reverse_iterator(this->begin()); }
+
+            //Capacity
+            bool        empty() const { return (this->length == 0); }
+            size_type   size() const { return this->length; }
+            size_type   max_size() const { return (std::numeric_limits<size_type>::max() / sizeof(value_type)); }
+
+            //Element access
+            mapped_type &operator[](const key_type& k);
+
+            //Modifiers
+            pair<iterator, bool>    insert(const value_type &value);
+            iterator                insert(iterator position, const value_type &value);
+            void                    erase(iterator position);
+            size_type               erase(const key_type &value);
+            void                    erase(iterator first, iterator last);
+            void                    swap(btree_map &x);
+            void                    clear();
+
+# if __cplusplus >= 201103L
+            pair<iterator, bool>    insert(value_type &&value);
+            template <class... Args>
+            pair<iterator, bool>    emplace(Args&&... args);
+# endif
+
+            template <class InputIterator>
+            void insert(InputIterator first, InputIterator last)
+            {
+                for (; first != last; ++first)
+                    this->insert(this->end(), *first);
+            }
+
+            //Observers
+            key_compare         key_comp(void) const    { return (comp);}
+            value_compare       value_comp(void) const  { return (value_compare(this->comp));}
+
+            //Operations
+            iterator            find(const key_type &value);
+            const_iterator      find(const key_type &value) const;
+            size_type           count(const key_type &value) const;
+            iterator            lower_bound(const key_type &key);
+            const_iterator      lower_bound(const key_type &key) const;
+            iterator            upper_bound(const key_type &key);
+            const_iterator      upper_bound(const key_type &key) const;
+
+            pair<const_iterator, const_iterator> equal_range(const key_type &k) const
+            {
+                return (pair<const_iterator, const_iterator>(this->lower_bound(k), this->upper_bound(k)));
+            }
+            pair<iterator, iterator> equal_range(const key_type &k)
+            {
+                return (pair<iterator, iterator>(this->lower_bound(k), this->upper_bound(k)));
+            }
+
+        private:
+            node                newNode(bool leaf);
+            void                freeNode(node target);
+            void                destroySubtree(node target);
+            node                cloneSubtree(const node_type *source, node parent);
+            void                updateEdges();
+            size_type           lowerBoundIn(const node_type *target, const key_type &key) const;
+            size_type           upperBoundIn(const node_type *target, const key_type &key) const;
+            pair<node, size_type>   lowerBoundPos(const key_type &key) const;
+            pair<node, size_type>   upperBoundPos(const key_type &key) const;
+            template <class V>
+            iterator            insertAt(node target, size_type i, V &value);
+            template <class V>
+            pair<iterator, bool>    insertUnique(V &value);
+            void                setChild(node parent, size_type i, node child);
+            void                splitNode(node target);
+            void                eraseAt(node target, size_type i);
+            void                eraseRun(node leaf, size_type i, size_type n);
+            void                rebalance(node target);
+            void                rotateFromLeft(node target);
+            void                rotateFromRight(node target);
+            void                mergeWithRight(node left);
+    };
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    const typename btree_map<Key, T, Compare, Alloc, NodeBytes>::size_type btree_map<Key, T, Compare, Alloc, NodeBytes>::slots;
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    btree_map<Key, T, Compare, Alloc, NodeBytes>::btree_map(const Compare& comp, const Alloc& alloc)
+    {
+        this->alloc = alloc;
+        this->leafAlloc = leaf_allocator_type(alloc);
+        this->internalAlloc = internal_allocator_type(alloc);
+        this->comp = comp;
+        this->root = NULL;
+        this->leftmost = NULL;
+        this->rightmost = NULL;
+        this->length = 0;
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    btree_map<Key, T, Compare, Alloc, NodeBytes>::btree_map(const btree_map &other)
+    {
+        this->alloc = other.alloc;
+        this->leafAlloc = leaf_allocator_type(other.alloc);
+        this->internalAlloc = internal_allocator_type(other.alloc);
+        this->comp = other.comp;
+        this->root = NULL;
+        this->leftmost = NULL;
+        this->rightmost = NULL;
+        this->length = 0;
+        if (other.root)
+        {
+            this->root = this->cloneSubtree(other.root, NULL);
+            this->length = other.length;
+            this->updateEdges();
+        }
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    btree_map<Key, T, Compare, Alloc, NodeBytes>::~btree_map()
+    {
+        this->clear();
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    btree_map<Key, T, Compare, Alloc, NodeBytes> &btree_map<Key, T, Compare, Alloc, NodeBytes>::operator=(const btree_map &other)
+    {
+        if (this == &other)
+            return *this;
+        this->clear();
+        this->comp = other.comp;
+        if (other.root)
+        {
+            this->root = this->cloneSubtree(other.root, NULL);
+            this->length = other.length;
+            this->updateEdges();
+        }
+        return *this;
+    }
+
+# if __cplusplus >= 201103L
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    btree_map<Key, T, Compare, Alloc, NodeBytes>::btree_map(btree_map &&other)
+    {
+        this->alloc = other.alloc;
+        this->leafAlloc = leaf_allocator_type(other.alloc);
+        this->internalAlloc = internal_allocator_type(other.alloc);
+        this->comp = other.comp;
+        this->root = NULL;
+        this->leftmost = NULL;
+        this->rightmost = NULL;
+        this->length = 0;
+        this->swap(other);
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    btree_map<Key, T, Compare, Alloc, NodeBytes> &btree_map<Key, T, Compare, Alloc, NodeBytes>::operator=(btree_map &&other)
+    {
+        if (this != &other)
+        {
+            this->clear();
+            this->swap(other);
+        }
+        return *this;
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    pair<typename btree_map<Key, T, Compare, Alloc, NodeBytes>::iterator, bool> btree_map<Key, T, Compare, Alloc, NodeBytes>::insert(value_type &&value)
+    {
+        return this->insertUnique(value);
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    template <class... Args>
+    pair<typename btree_map<Key, T, Compare, Alloc, NodeBytes>::iterator, bool> btree_map<Key, T, Compare, Alloc, NodeBytes>::emplace(Args&&... args)
+    {
+        value_type  value(std::forward<Args>(args)...);
+
+        return this->insertUnique(value);
+    }
+# endif
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    typename btree_map<Key, T, Compare, Alloc, NodeBytes>::mapped_type &btree_map<Key, T, Compare, Alloc, NodeBytes>::operator[](const key_type& k)
+    {
+        iterator tmp = this->find(k);
+
+        if (tmp != this->end())
+            return tmp->second;
+        return (this->insert(ft::make_pair(k, mapped_type())).first->second);
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    pair<typename btree_map<Key, T, Compare, Alloc, NodeBytes>::iterator, bool> btree_map<Key, T, Compare, Alloc, NodeBytes>::insert(const value_type &value)
+    {
+        return this->insertUnique(value);
+    }
+
+    // The hint is used when value belongs right before it, which makes
+    // ascending bulk loads through end() constant time per element.
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    typename btree_map<Key, T, Compare, Alloc, NodeBytes>::iterator btree_map<Key, T, Compare, Alloc, NodeBytes>::insert(iterator position, const value_type &value)
+    {
+        if (this->root == NULL)
+            return this->insert(value).first;
+        if (position != this->end() && !this->comp(value.first, position->first))
+            return this->insert(value).first;
+        if (position != this->begin())
+        {
+            iterator    prev = position;
+
+            --prev;
+            if (!this->comp(prev->first, value.first))
+                return this->insert(value).first;
+            if (prev.base()->leaf)
+                return this->insertAt(prev.base(), prev.index() + 1, value);
+        }
+        return this->insertAt(position.base(), position.index(), value);
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    void btree_map<Key, T, Compare, Alloc, NodeBytes>::erase(iterator position)
+    {
+        if (position.base() == NULL || position == this->end())
+            return;
+        this->eraseAt(position.base(), position.index());
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    typename btree_map<Key, T, Compare, Alloc, NodeBytes>::size_type btree_map<Key, T, Compare, Alloc, NodeBytes>::erase(const key_type &value)
+    {
+        iterator    item = this->find(value);
+
+        if (item == this->end())
+            return (0);
+        this->eraseAt(item.base(), item.index());
+        return (1);
+    }
+
+    // Erases a leaf run at a time. A run that leaves its leaf at or above
+    // the minimum fill moves nothing else, so iteration simply goes on; only
+    // runs that rebalance, and values of internal nodes, look the next
+    // position up again by key.
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    void btree_map<Key, T, Compare, Alloc, NodeBytes>::erase(iterator first, iterator last)
+    {
+        const size_type minCount = (slots - 1) / 2;
+        size_type       n = 0;
+
+        if (first == this->begin() && last == this->end())
+        {
+            this->clear();
+            return;
+        }
+        for (iterator it = first; it != last; ++it)
+            n++;
+        while (n)
+        {
+            node        target = first.base();
+            size_type   i = first.index();
+            size_type   run = target->leaf ? std::min<size_type>(target->count - i, n) : 1;
+
+            n -= run;
+            if (!target->leaf || (target != this->root && target->count - run < minCount))
+            {
+                key_type    key = target->values()[i + run - 1].first;
+
+                if (target->leaf)
+                    this->eraseRun(target, i, run);
+                else
+                    this->eraseAt(target, i);
+                if (n)
+                    first = this->lower_bound(key);
+                continue;
+            }
+            iterator    next(target, i + run - 1);
+
+            ++next;
+            this->eraseRun(target, i, run);
+            first = i < target->count ? iterator(target, i) : next;
+        }
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    void btree_map<Key, T, Compare, Alloc, NodeBytes>::swap(btree_map &x)
+    {
+        std::swap(this->alloc, x.alloc);
+        std::swap(this->leafAlloc, x.leafAlloc);
+        std::swap(this->internalAlloc, x.internalAlloc);
+        std::swap(this->comp, x.comp);
+        std::swap(this->root, x.root);
+        std::swap(this->leftmost, x.leftmost);
+        std::swap(this->rightmost, x.rightmost);
+        std::swap(this->length, x.length);
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    void btree_map<Key, T, Compare, Alloc, NodeBytes>::clear()
+    {
+        if (this->root)
+            this->destroySubtree(this->root);
+        this->root = NULL;
+        this->leftmost = NULL;
+        this->rightmost = NULL;
+        this->length = 0;
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    typename btree_map<Key, T, Compare, Alloc, NodeBytes>::iterator btree_map<Key, T, Compare, Alloc, NodeBytes>::find(const key_type &value)
+    {
+        pair<node, size_type>   pos = this->lowerBoundPos(value);
+
+        if (pos.first == NULL || pos.second == pos.first->count || this->comp(value, pos.first->values()[pos.second].first))
+            return this->end();
+        return iterator(pos.first, pos.second);
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    typename btree_map<Key, T, Compare, Alloc, NodeBytes>::const_iterator btree_map<Key, T, Compare, Alloc, NodeBytes>::find(const key_type &value) const
+    {
+        pair<node, size_type>   pos = this->lowerBoundPos(value);
+
+        if (pos.first == NULL || pos.second == pos.first->count || this->comp(value, pos.first->values()[pos.second].first))
+            return this->end();
+        return const_iterator(pos.first, pos.second);
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    typename btree_map<Key, T, Compare, Alloc, NodeBytes>::size_type btree_map<Key, T, Compare, Alloc, NodeBytes>::count(const key_type &value) const
+    {
+        return (this->find(value) != this->end());
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    typename btree_map<Key, T, Compare, Alloc, NodeBytes>::iterator btree_map<Key, T, Compare, Alloc, NodeBytes>::lower_bound(const key_type &key)
+    {
+        pair<node, size_type>   pos = this->lowerBoundPos(key);
+
+        return iterator(pos.first, pos.second);
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    typename btree_map<Key, T, Compare, Alloc, NodeBytes>::const_iterator btree_map<Key, T, Compare, Alloc, NodeBytes>::lower_bound(const key_type &key) const
+    {
+        pair<node, size_type>   pos = this->lowerBoundPos(key);
+
+        return const_iterator(pos.first, pos.second);
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    typename btree_map<Key, T, Compare, Alloc, NodeBytes>::iterator btree_map<Key, T, Compare, Alloc, NodeBytes>::upper_bound(const key_type &key)
+    {
+        pair<node, size_type>   pos = this->upperBoundPos(key);
+
+        return iterator(pos.first, pos.second);
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    typename btree_map<Key, T, Compare, Alloc, NodeBytes>::const_iterator btree_map<Key, T, Compare, Alloc, NodeBytes>::upper_bound(const key_type &key) const
+    {
+        pair<node, size_type>   pos = this->upperBoundPos(key);
+
+        return const_iterator(pos.first, pos.second);
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    typename btree_map<Key, T, Compare, Alloc, NodeBytes>::node btree_map<Key, T, Compare, Alloc, NodeBytes>::newNode(bool leaf)
+    {
+        if (leaf)
+            return ::new (this->leafAlloc.allocate(1)) node_type(true);
+        return ::new (this->internalAlloc.allocate(1)) internal_node_type();
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    void btree_map<Key, T, Compare, Alloc, NodeBytes>::freeNode(node target)
+    {
+        if (target->leaf)
+            this->leafAlloc.deallocate(target, 1);
+        else
+            this->internalAlloc.deallocate(static_cast<internal_node_type *>(target), 1);
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    void btree_map<Key, T, Compare, Alloc, NodeBytes>::destroySubtree(node target)
+    {
+        value_type  *values = target->values();
+
+        if (!target->leaf)
+        {
+            for (size_type i = 0; i <= target->count; i++)
+                this->destroySubtree(target->child(i));
+        }
+        for (size_type i = 0; i < target->count; i++)
+            allocDestroy(this->alloc, values + i);
+        this->freeNode(target);
+    }
+
+    // Copies the node layout as is; on failure everything built so far is
+    // released again.
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    typename btree_map<Key, T, Compare, Alloc, NodeBytes>::node btree_map<Key, T, Compare, Alloc, NodeBytes>::cloneSubtree(const node_type *source, node parent)
+    {
+        node    copy = this->newNode(source->leaf);
+        size_type   children = 0;
+
+        copy->parent = parent;
+        copy->position = source->position;
+        try
+        {
+            for (; copy->count < source->count; copy->count++)
+                allocConstruct(this->alloc, copy->values() + copy->count, source->values()[copy->count]);
+            if (!source->leaf)
+            {
+                for (; children <= source->count; children++)
+                    copy->child(children) = this->cloneSubtree(source->child(children), copy);
+            }
+        }
+        catch (...)
+        {
+            size_type   built = copy->count;
+
+            if (!copy->leaf)
+            {
+                for (size_type i = 0; i < children; i++)
+                    this->destroySubtree(copy->child(i));
+            }
+            for (size_type i = 0; i < built; i++)
+                allocDestroy(this->alloc, copy->values() + i);
+            this->freeNode(copy);
+            throw;
+        }
+        return copy;
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    void btree_map<Key, T, Compare, Alloc, NodeBytes>::updateEdges()
+    {
+        this->leftmost = this->root ? leftmostLeaf(this->root) : NULL;
+        this->rightmost = this->root ? rightmostLeaf(this->root) : NULL;
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    typename btree_map<Key, T, Compare, Alloc, NodeBytes>::size_type btree_map<Key, T, Compare, Alloc, NodeBytes>::lowerBoundIn(const node_type *target, const key_type &key) const
+    {
+        const value_type    *values = target->values();
+        size_type           lo = 0;
+        size_type           hi = target->count;
+
+        while (lo < hi)
+        {
+            size_type   mid = (lo + hi) / 2;
+
+            if (this->comp(values[mid].first, key))
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    typename btree_map<Key, T, Compare, Alloc, NodeBytes>::size_type btree_map<Key, T, Compare, Alloc, NodeBytes>::upperBoundIn(const node_type *target, const key_type &key) const
+    {
+        const value_type    *values = target->values();
+        size_type           lo = 0;
+        size_type           hi = target->count;
+
+        while (lo < hi)
+        {
+            size_type   mid = (lo + hi) / 2;
+
+            if (this->comp(key, values[mid].first))
+                hi = mid;
+            else
+                lo = mid + 1;
+        }
+        return lo;
+    }
+
+    // Separator values passed on the way down are the candidates; the leaf
+    // position wins when it is inside the leaf.
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    pair<typename btree_map<Key, T, Compare, Alloc, NodeBytes>::node, typename btree_map<Key, T, Compare, Alloc, NodeBytes>::size_type>
+    btree_map<Key, T, Compare, Alloc, NodeBytes>::lowerBoundPos(const key_type &key) const
+    {
+        node        cur = this->root;
+        pair<node, size_type>   result(this->rightmost, this->rightmost ? this->rightmost->count : 0);
+
+        while (cur)
+        {
+            size_type   i = this->lowerBoundIn(cur, key);
+
+            if (i < cur->count)
+            {
+                result = pair<node, size_type>(cur, i);
+                if (!this->comp(key, cur->values()[i].first))
+                    break;
+            }
+            if (cur->leaf)
+                break;
+            cur = cur->child(i);
+        }
+        return result;
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    pair<typename btree_map<Key, T, Compare, Alloc, NodeBytes>::node, typename btree_map<Key, T, Compare, Alloc, NodeBytes>::size_type>
+    btree_map<Key, T, Compare, Alloc, NodeBytes>::upperBoundPos(const key_type &key) const
+    {
+        node        cur = this->root;
+        pair<node, size_type>   result(this->rightmost, this->rightmost ? this->rightmost->count : 0);
+
+        while (cur)
+        {
+            size_type   i = this->upperBoundIn(cur, key);
+
+            if (i < cur->count)
+                result = pair<node, size_type>(cur, i);
+            if (cur->leaf)
+                break;
+            cur = cur->child(i);
+        }
+        return result;
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    template <class V>
+    pair<typename btree_map<Key, T, Compare, Alloc, NodeBytes>::iterator, bool> btree_map<Key, T, Compare, Alloc, NodeBytes>::insertUnique(V &value)
+    {
+        node        cur = this->root;
+        size_type   i = 0;
+
+        while (cur)
+        {
+            i = this->lowerBoundIn(cur, value.first);
+            if (i < cur->count && !this->comp(value.first, cur->values()[i].first))
+                return (pair<iterator, bool>(iterator(cur, i), false));
+            if (cur->leaf)
+                break;
+            cur = cur->child(i);
+        }
+        return (pair<iterator, bool>(this->insertAt(cur, i, value), true));
+    }
+
+    // Inserts value at slot i of a leaf (or of an empty tree), splitting the
+    // leaf first when it is full.
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    template <class V>
+    typename btree_map<Key, T, Compare, Alloc, NodeBytes>::iterator btree_map<Key, T, Compare, Alloc, NodeBytes>::insertAt(node target, size_type i, V &value)
+    {
+        bool    split = false;
+
+        if (target == NULL)
+        {
+            this->root = this->newNode(true);
+            this->leftmost = this->root;
+            this->rightmost = this->root;
+            target = this->root;
+            i = 0;
+        }
+        if (target->count == slots)
+        {
+            this->splitNode(target);
+            if (i > slots / 2)
+            {
+                i -= slots / 2 + 1;
+                target = target->parent->child(target->position + 1);
+            }
+            split = true;
+        }
+        value_type  *values = target->values();
+
+        relocate(this->alloc, values + i, values + target->count, values + i + 1);
+        try
+        {
+            allocConstruct(this->alloc, values + i, moveValue(value));
+        }
+        catch (...)
+        {
+            relocate(this->alloc, values + i + 1, values + target->count + 1, values + i);
+            if (split)
+                this->updateEdges();
+            throw;
+        }
+        target->count++;
+        this->length++;
+        if (split)
+            this->updateEdges();
+        return iterator(target, i);
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    void btree_map<Key, T, Compare, Alloc, NodeBytes>::setChild(node parent, size_type i, node child)
+    {
+        parent->child(i) = child;
+        child->parent = parent;
+        child->position = static_cast<unsigned short>(i);
+    }
+
+    // Moves the upper half of a full node into a new right sibling and its
+    // median into the parent, splitting full ancestors first.
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    void btree_map<Key, T, Compare, Alloc, NodeBytes>::splitNode(node target)
+    {
+        const size_type mid = slots / 2;
+
+        if (target->parent && target->parent->count == slots)
+            this->splitNode(target->parent);
+        node        right = this->newNode(target->leaf);
+
+        if (target->parent == NULL)
+        {
+            try
+            {
+                this->root = this->newNode(false);
+            }
+            catch (...)
+            {
+                this->freeNode(right);
+                throw;
+            }
+            this->setChild(this->root, 0, target);
+        }
+        node        parent = target->parent;
+        size_type   pos = target->position;
+        value_type  *values = target->values();
+        value_type  *parentValues = parent->values();
+
+        relocate(this->alloc, values + mid + 1, values + slots, right->values());
+        right->count = static_cast<unsigned short>(slots - mid - 1);
+        if (!target->leaf)
+        {
+            for (size_type j = 0; j <= right->count; j++)
+                this->setChild(right, j, target->child(mid + 1 + j));
+        }
+        relocate(this->alloc, parentValues + pos, parentValues + parent->count, parentValues + pos + 1);
+        relocate(this->alloc, values + mid, values + mid + 1, parentValues + pos);
+        for (size_type j = parent->count; j > pos; j--)
+            this->setChild(parent, j + 1, parent->child(j));
+        this->setChild(parent, pos + 1, right);
+        parent->count++;
+        target->count = static_cast<unsigned short>(mid);
+    }
+
+    // Internal values are replaced by their in-order predecessor, which always
+    // sits at the end of a leaf, so removal itself only happens in leaves.
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    void btree_map<Key, T, Compare, Alloc, NodeBytes>::eraseAt(node target, size_type i)
+    {
+        value_type  *values = target->values();
+
+        allocDestroy(this->alloc, values + i);
+        if (!target->leaf)
+        {
+            node        leaf = rightmostLeaf(target->child(i));
+            value_type  *leafValues = leaf->values();
+
+            relocate(this->alloc, leafValues + leaf->count - 1, leafValues + leaf->count, values + i);
+            target = leaf;
+        }
+        else
+            relocate(this->alloc, values + i + 1, values + target->count, values + i);
+        target->count--;
+        this->length--;
+        this->rebalance(target);
+        this->updateEdges();
+    }
+
+    // Removes values [i, i + n) of a leaf.
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    void btree_map<Key, T, Compare, Alloc, NodeBytes>::eraseRun(node leaf, size_type i, size_type n)
+    {
+        value_type  *values = leaf->values();
+
+        for (size_type j = i; j < i + n; j++)
+            allocDestroy(this->alloc, values + j);
+        relocate(this->alloc, values + i + n, values + leaf->count, values + i);
+        leaf->count = static_cast<unsigned short>(leaf->count - n);
+        this->length -= n;
+        this->rebalance(leaf);
+        this->updateEdges();
+    }
+
+    // Restores the minimum fill of (slots - 1) / 2 values from target up to
+    // the root by borrowing from siblings or merging with one. Only a leaf
+    // emptied by eraseRun can be short by more than one value.
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    void btree_map<Key, T, Compare, Alloc, NodeBytes>::rebalance(node target)
+    {
+        const size_type minCount = (slots - 1) / 2;
+
+        while (target != this->root && target->count < minCount)
+        {
+            node        parent = target->parent;
+            size_type   pos = target->position;
+            node        left = pos > 0 ? parent->child(pos - 1) : NULL;
+            node        right = pos < parent->count ? parent->child(pos + 1) : NULL;
+
+            while (target->count < minCount && left && left->count > minCount)
+                this->rotateFromLeft(target);
+            while (target->count < minCount && right && right->count > minCount)
+                this->rotateFromRight(target);
+            if (target->count >= minCount)
+                return;
+            if (left)
+                this->mergeWithRight(left);
+            else
+                this->mergeWithRight(target);
+            target = parent;
+        }
+        if (this->root->count == 0)
+        {
+            node    old = this->root;
+
+            if (old->leaf)
+                this->root = NULL;
+            else
+            {
+                this->root = old->child(0);
+                this->root->parent = NULL;
+                this->root->position = 0;
+            }
+            this->freeNode(old);
+        }
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    void btree_map<Key, T, Compare, Alloc, NodeBytes>::rotateFromLeft(node target)
+    {
+        node        parent = target->parent;
+        size_type   sep = target->position - 1;
+        node        left = parent->child(sep);
+        value_type  *values = target->values();
+        value_type  *leftValues = left->values();
+        value_type  *parentValues = parent->values();
+
+        relocate(this->alloc, values, values + target->count, values + 1);
+        relocate(this->alloc, parentValues + sep, parentValues + sep + 1, values);
+        relocate(this->alloc, leftValues + left->count - 1, leftValues + left->count, parentValues + sep);
+        if (!target->leaf)
+        {
+            for (size_type j = target->count + 1; j > 0; j--)
+                this->setChild(target, j, target->child(j - 1));
+            this->setChild(target, 0, left->child(left->count));
+        }
+        target->count++;
+        left->count--;
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    void btree_map<Key, T, Compare, Alloc, NodeBytes>::rotateFromRight(node target)
+    {
+        node        parent = target->parent;
+        size_type   sep = target->position;
+        node        right = parent->child(sep + 1);
+        value_type  *values = target->values();
+        value_type  *rightValues = right->values();
+        value_type  *parentValues = parent->values();
+
+        relocate(this->alloc, parentValues + sep, parentValues + sep + 1, values + target->count);
+        relocate(this->alloc, rightValues, rightValues + 1, parentValues + sep);
+        relocate(this->alloc, rightValues + 1, rightValues + right->count, rightValues);
+        if (!target->leaf)
+        {
+            this->setChild(target, target->count + 1, right->child(0));
+            for (size_type j = 0; j < right->count; j++)
+                this->setChild(right, j, right->child(j + 1));
+        }
+        target->count++;
+        right->count--;
+    }
+
+    // Pulls the separator down and appends the right sibling to left, then
+    // drops the sibling from the parent.
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    void btree_map<Key, T, Compare, Alloc, NodeBytes>::mergeWithRight(node left)
+    {
+        node        parent = left->parent;
+        size_type   sep = left->position;
+        node        right = parent->child(sep + 1);
+        value_type  *leftValues = left->values();
+        value_type  *rightValues = right->values();
+        value_type  *parentValues = parent->values();
+
+        relocate(this->alloc, parentValues + sep, parentValues + sep + 1, leftValues + left->count);
+        relocate(this->alloc, rightValues, rightValues + right->count, leftValues + left->count + 1);
+        if (!left->leaf)
+        {
+            for (size_type j = 0; j <= right->count; j++)
+                this->setChild(left, left->count + 1 + j, right->child(j));
+        }
+        left->count = static_cast<unsigned short>(left->count + right->count + 1);
+        relocate(this->alloc, parentValues + sep + 1, parentValues + parent->count, parentValues + sep);
+        for (size_type j = sep + 1; j < parent->count; j++)
+            this->setChild(parent, j, parent->child(j + 1));
+        parent->count--;
+        this->freeNode(right);
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes >
+    void    swap(btree_map<Key, T, Compare, Alloc, NodeBytes> &x, btree_map<Key, T, Compare, Alloc, NodeBytes> &y)
+    {
+        x.swap(y);
+    }
+
+}
+
+#endif
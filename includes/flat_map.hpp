@@ -0,0 +1,440 @@
+#ifndef FT_FLAT_MAP_HPP
+# define FT_FLAT_MAP_HPP
+
+# include <memory>
+# include <algorithm>
+# include <functional>
+# include <iterator>
+# include <stdexcept>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+# include "vector.hpp"
+# include "Utils/Pair.hpp"
+# include "Utils/Relocate.hpp"
+# include "Utils/SortedUnique.hpp"
+# include "Utils/FlatMerge.hpp"
+# include "Utils/FlatMapIterator.hpp"
+
+namespace ft
+{
+
+    // Sorted associative array with the lookup interface of ft::map. Keys
+    // and mapped values live in two parallel contiguous containers, so a
+    // lookup is a binary search over the keys alone and a scan streams
+    // through memory. Insert and erase are O(n) and invalidate iterators;
+    // batches should go through the range insert, which sorts the new
+    // elements and merges them in one pass.
+    template<class Key, class T, class Compare = std::less<Key>, class KeyContainer = ft::vector<Key>, class MappedContainer = ft::vector<T> >
+    class flat_map
+    {
+        public:
+            typedef Key                                     key_type;
+            typedef T                                       mapped_type;
+            typedef pair<Key, T>                            value_type;
+            typedef Compare                                 key_compare;
+            typedef KeyContainer                            key_container_type;
+            typedef MappedContainer                         mapped_container_type;
+            typedef FlatMapReference<Key, T>                reference;
+            typedef FlatMapReference<Key, const T>          const_reference;
+            typedef std::size_t                             size_type;
+            typedef std::ptrdiff_t                          difference_type;
+
+            typedef FlatMapIterator<Key, T, T>              iterator;
+            typedef FlatMapIterator<Key, T, const T>        const_iterator;
+            typedef std::reverse_iterator<iterator>         reverse_iterator;
+            typedef std::reverse_iterator<const_iterator>   const_reverse_iterator;
+
+            class value_compare
+            {
+                friend class flat_map;
+
+                protected:
+                    Compare     comp;
+                    value_compare(Compare c) : comp(c) {}
+
+                public:
+                    typedef bool        result_type;
+                    typedef value_type  first_argument_type;
+                    typedef value_type  second_argument_type;
+
+                    bool operator() (const value_type &x, const value_type &y) const
+                    {
+                        return comp(x.first, y.first);
+                    }
+            };
+
+        private:
+            key_container_type      keys;
+            mapped_container_type   values;
+            key_compare             comp;
+
+        public:
+            explicit flat_map( const Compare& comp = Compare() ): keys(), values(), comp(comp) {}
+            flat_map( const flat_map &other ): keys(other.keys), values(other.values), comp(other.comp) {}
+
+            template< class InputIt >
+            flat_map( InputIt first, InputIt last, const Compare& comp = Compare() ): keys(), values(), comp(comp)
+            {
+                this->insert(first, last);
+            }
+
+            template< class InputIt >
+            flat_map( sorted_unique_t, InputIt first, InputIt last, const Compare& comp = Compare() ): keys(), values(), comp(comp)
+            {
+                this->insert(sorted_unique, first, last);
+            }
+
+            // Adopt the two containers, which must have the same size;
+            // both throw invalid_argument when they do not.
+            flat_map( const key_container_type &k, const mapped_container_type &m, const Compare& comp = Compare() );
+            flat_map( sorted_unique_t, const key_container_type &k, const mapped_container_type &m, const Compare& comp = Compare() ):
+                keys(k), values(m), comp(comp)
+            {
+                if (this->keys.size() != this->values.size())
+                    throw std::invalid_argument("flat_map");
+            }
+
+            ~flat_map() {}
+
+            flat_map &operator=(const flat_map &other);
+
+# if __cplusplus >= 201103L
+            flat_map( flat_map &&other ): keys(std::move(other.keys)), values(std::move(other.values)), comp(other.comp) {}
+            flat_map &operator=(flat_map &&other);
+# endif
+
+            //Iterators
+            iterator                begin() { return this->iteratorAt(0); }
+            const_iterator          begin() const { return this->iteratorAt(0); }
+            iterator                end() { return this->iteratorAt(this->size()); }
+            const_iterator          end() const { return this->iteratorAt(this->size()); }
+
+            reverse_iterator        rbegin() { return reverse_iterator(this->end()); }
+            const_reverse_iterator  rbegin() const { return const_reverse_iterator(this->end()); }
+            reverse_iterator        rend() { return reverse_iterator(this->begin()); }
+            const_reverse_iterator  rend() const { return const_reverse_iterator(this->begin()); }
+
+            //Capacity
+            bool        empty() const { return this->keys.empty(); }
+            size_type   size() const { return this->keys.size(); }
+            size_type   max_size() const { return std::min(this->keys.max_size(), this->values.max_size()); }
+            void        reserve(size_type n);
+
+            //Element access
+            mapped_type         &operator[](const key_type& k);
+            mapped_type         &at(const key_type& k);
+            const mapped_type   &at(const key_type& k) const;
+
+            //Modifiers
+            pair<iterator, bool>    insert(const value_type &value);
+            iterator                insert(iterator position, const value_type &value);
+            void                    erase(iterator position);
+            size_type               erase(const key_type &value);
+            void                    erase(iterator first, iterator last);
+            void                    swap(flat_map &x);
+            void                    clear();
+
+# if __cplusplus >= 201103L
+            pair<iterator, bool>    insert(value_type &&value);
+            template <class... Args>
+            pair<iterator, bool>    emplace(Args&&... args)
+            {
+                value_type  value(std::forward<Args>(args)...);
+
+                return this->insertAt(this->lowerBoundIndex(value.first), value);
+            }
+# endif
+
+            template <class InputIterator>
+            void insert(InputIterator first, InputIterator last)
+            {
+                ft::vector<value_type>  batch;
+
+                for (; first != last; ++first)
+                    batch.push_back(*first);
+                this->mergeBatch(batch, false);
+            }
+
+            template <class InputIterator>
+            void insert(sorted_unique_t, InputIterator first, InputIterator last)
+            {
+                ft::vector<value_type>  batch;
+
+                for (; first != last; ++first)
+                    batch.push_back(*first);
+                this->mergeBatch(batch, true);
+            }
+
+            //Observers
+            key_compare                 key_comp(void) const    { return (comp);}
+            value_compare               value_comp(void) const  { return (value_compare(this->comp));}
+            const key_container_type    &keys_container() const { return this->keys; }
+            const mapped_container_type &values_container() const { return this->values; }
+
+            //Operations
+            iterator            find(const key_type &value);
+            const_iterator      find(const key_type &value) const;
+            size_type           count(const key_type &value) const;
+            iterator            lower_bound(const key_type &key) { return this->iteratorAt(this->lowerBoundIndex(key)); }
+            const_iterator      lower_bound(const key_type &key) const { return this->iteratorAt(this->lowerBoundIndex(key)); }
+            iterator            upper_bound(const key_type &key) { return this->iteratorAt(this->upperBoundIndex(key)); }
+            const_iterator      upper_bound(const key_type &key) const { return this->iteratorAt(this->upperBoundIndex(key)); }
+
+            pair<const_iterator, const_iterator> equal_range(const key_type &k) const
+            {
+                return (pair<const_iterator, const_iterator>(this->lower_bound(k), this->upper_bound(k)));
+            }
+            pair<iterator, iterator> equal_range(const key_type &k)
+            {
+                return (pair<iterator, iterator>(this->lower_bound(k), this->upper_bound(k)));
+            }
+
+        private:
+            typedef FlatPairColumns<key_container_type, mapped_container_type>  columns_type;
+
+            iterator            iteratorAt(size_type i) { return iterator(this->keys.data() + i, this->values.data() + i); }
+            const_iterator      iteratorAt(size_type i) const { return const_iterator(this->keys.data() + i, this->values.data() + i); }
+            size_type           indexOf(const_iterator it) const { return it.keyBase() - this->keys.data(); }
+            size_type           lowerBoundIndex(const key_type &key) const;
+            size_type           upperBoundIndex(const key_type &key) const;
+            size_type           findIndex(const key_type &key) const;
+            template <class V>
+            pair<iterator, bool>    insertAt(size_type i, V &value);
+            void                mergeBatch(ft::vector<value_type> &batch, bool sorted);
+    };
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    flat_map<Key, T, Compare, KeyContainer, MappedContainer>::flat_map(const key_container_type &k, const mapped_container_type &m, const Compare& comp):
+        keys(), values(), comp(comp)
+    {
+        ft::vector<value_type>  batch;
+
+        if (m.size() != k.size())
+            throw std::invalid_argument("flat_map");
+        batch.reserve(k.size());
+        for (size_type i = 0; i < k.size(); i++)
+            batch.push_back(value_type(k[i], m[i]));
+        this->mergeBatch(batch, false);
+    }
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    flat_map<Key, T, Compare, KeyContainer, MappedContainer> &flat_map<Key, T, Compare, KeyContainer, MappedContainer>::operator=(const flat_map &other)
+    {
+        if (this == &other)
+            return *this;
+        this->keys = other.keys;
+        this->values = other.values;
+        this->comp = other.comp;
+        return *this;
+    }
+
+# if __cplusplus >= 201103L
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    flat_map<Key, T, Compare, KeyContainer, MappedContainer> &flat_map<Key, T, Compare, KeyContainer, MappedContainer>::operator=(flat_map &&other)
+    {
+        if (this != &other)
+        {
+            this->keys = std::move(other.keys);
+            this->values = std::move(other.values);
+            this->comp = other.comp;
+        }
+        return *this;
+    }
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    pair<typename flat_map<Key, T, Compare, KeyContainer, MappedContainer>::iterator, bool> flat_map<Key, T, Compare, KeyContainer, MappedContainer>::insert(value_type &&value)
+    {
+        return this->insertAt(this->lowerBoundIndex(value.first), value);
+    }
+# endif
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    void flat_map<Key, T, Compare, KeyContainer, MappedContainer>::reserve(size_type n)
+    {
+        this->keys.reserve(n);
+        this->values.reserve(n);
+    }
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    typename flat_map<Key, T, Compare, KeyContainer, MappedContainer>::mapped_type &flat_map<Key, T, Compare, KeyContainer, MappedContainer>::operator[](const key_type& k)
+    {
+        size_type   i = this->lowerBoundIndex(k);
+
+        if (i == this->size() || this->comp(k, this->keys[i]))
+        {
+            value_type  value(k, mapped_type());
+
+            this->insertAt(i, value);
+        }
+        return this->values[i];
+    }
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    typename flat_map<Key, T, Compare, KeyContainer, MappedContainer>::mapped_type &flat_map<Key, T, Compare, KeyContainer, MappedContainer>::at(const key_type& k)
+    {
+        size_type   i = this->findIndex(k);
+
+        if (i == this->size())
+            throw std::out_of_range("flat_map");
+        return this->values[i];
+    }
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    const typename flat_map<Key, T, Compare, KeyContainer, MappedContainer>::mapped_type &flat_map<Key, T, Compare, KeyContainer, MappedContainer>::at(const key_type& k) const
+    {
+        size_type   i = this->findIndex(k);
+
+        if (i == this->size())
+            throw std::out_of_range("flat_map");
+        return this->values[i];
+    }
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    pair<typename flat_map<Key, T, Compare, KeyContainer, MappedContainer>::iterator, bool> flat_map<Key, T, Compare, KeyContainer, MappedContainer>::insert(const value_type &value)
+    {
+        return this->insertAt(this->lowerBoundIndex(value.first), value);
+    }
+
+    // A correct hint (prev < value < hint) skips the binary search, so
+    // ascending inserts through end() only pay for the append.
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    typename flat_map<Key, T, Compare, KeyContainer, MappedContainer>::iterator flat_map<Key, T, Compare, KeyContainer, MappedContainer>::insert(iterator position, const value_type &value)
+    {
+        size_type   i = this->indexOf(position);
+
+        if ((i < this->size() && !this->comp(value.first, this->keys[i]))
+            || (i > 0 && !this->comp(this->keys[i - 1], value.first)))
+            return this->insert(value).first;
+        return this->insertAt(i, value).first;
+    }
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    void flat_map<Key, T, Compare, KeyContainer, MappedContainer>::erase(iterator position)
+    {
+        size_type   i = this->indexOf(position);
+
+        this->keys.erase(this->keys.begin() + i);
+        this->values.erase(this->values.begin() + i);
+    }
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    typename flat_map<Key, T, Compare, KeyContainer, MappedContainer>::size_type flat_map<Key, T, Compare, KeyContainer, MappedContainer>::erase(const key_type &value)
+    {
+        size_type   i = this->findIndex(value);
+
+        if (i == this->size())
+            return (0);
+        this->keys.erase(this->keys.begin() + i);
+        this->values.erase(this->values.begin() + i);
+        return (1);
+    }
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    void flat_map<Key, T, Compare, KeyContainer, MappedContainer>::erase(iterator first, iterator last)
+    {
+        size_type   from = this->indexOf(first);
+        size_type   to = this->indexOf(last);
+
+        this->keys.erase(this->keys.begin() + from, this->keys.begin() + to);
+        this->values.erase(this->values.begin() + from, this->values.begin() + to);
+    }
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    void flat_map<Key, T, Compare, KeyContainer, MappedContainer>::swap(flat_map &x)
+    {
+        this->keys.swap(x.keys);
+        this->values.swap(x.values);
+        std::swap(this->comp, x.comp);
+    }
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    void flat_map<Key, T, Compare, KeyContainer, MappedContainer>::clear()
+    {
+        this->keys.clear();
+        this->values.clear();
+    }
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    typename flat_map<Key, T, Compare, KeyContainer, MappedContainer>::iterator flat_map<Key, T, Compare, KeyContainer, MappedContainer>::find(const key_type &value)
+    {
+        return this->iteratorAt(this->findIndex(value));
+    }
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    typename flat_map<Key, T, Compare, KeyContainer, MappedContainer>::const_iterator flat_map<Key, T, Compare, KeyContainer, MappedContainer>::find(const key_type &value) const
+    {
+        return this->iteratorAt(this->findIndex(value));
+    }
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    typename flat_map<Key, T, Compare, KeyContainer, MappedContainer>::size_type flat_map<Key, T, Compare, KeyContainer, MappedContainer>::count(const key_type &value) const
+    {
+        return (this->findIndex(value) != this->size());
+    }
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    typename flat_map<Key, T, Compare, KeyContainer, MappedContainer>::size_type flat_map<Key, T, Compare, KeyContainer, MappedContainer>::lowerBoundIndex(const key_type &key) const
+    {
+        const key_type  *first = this->keys.data();
+
+        return std::lower_bound(first, first + this->size(), key, this->comp) - first;
+    }
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    typename flat_map<Key, T, Compare, KeyContainer, MappedContainer>::size_type flat_map<Key, T, Compare, KeyContainer, MappedContainer>::upperBoundIndex(const key_type &key) const
+    {
+        const key_type  *first = this->keys.data();
+
+        return std::upper_bound(first, first + this->size(), key, this->comp) - first;
+    }
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    typename flat_map<Key, T, Compare, KeyContainer, MappedContainer>::size_type flat_map<Key, T, Compare, KeyContainer, MappedContainer>::findIndex(const key_type &key) const
+    {
+        size_type   i = this->lowerBoundIndex(key);
+
+        if (i < this->size() && this->comp(key, this->keys[i]))
+            return this->size();
+        return i;
+    }
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    template <class V>
+    pair<typename flat_map<Key, T, Compare, KeyContainer, MappedContainer>::iterator, bool> flat_map<Key, T, Compare, KeyContainer, MappedContainer>::insertAt(size_type i, V &value)
+    {
+        if (i < this->size() && !this->comp(value.first, this->keys[i]))
+            return (pair<iterator, bool>(this->iteratorAt(i), false));
+        this->keys.insert(this->keys.begin() + i, moveValue(value.first));
+        try
+        {
+            this->values.insert(this->values.begin() + i, moveValue(value.second));
+        }
+        catch (...)
+        {
+            this->keys.erase(this->keys.begin() + i);
+            throw;
+        }
+        return (pair<iterator, bool>(this->iteratorAt(i), true));
+    }
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    void flat_map<Key, T, Compare, KeyContainer, MappedContainer>::mergeBatch(ft::vector<value_type> &batch, bool sorted)
+    {
+        key_container_type      mergedKeys;
+        mapped_container_type   mergedValues;
+        columns_type            target(this->keys, this->values);
+        columns_type            merged(mergedKeys, mergedValues);
+
+        mergeSortedBatch(target, merged, batch.data(), batch.size(), sorted, this->comp);
+    }
+
+    template<class Key, class T, class Compare, class KeyContainer, class MappedContainer >
+    void    swap(flat_map<Key, T, Compare, KeyContainer, MappedContainer> &x, flat_map<Key, T, Compare, KeyContainer, MappedContainer> &y)
+    {
+        x.swap(y);
+    }
+
+}
+
+#endif
@@ -0,0 +1,261 @@
+#ifndef FT_FLAT_SET_HPP
+# define FT_FLAT_SET_HPP
+
+# include <memory>
+# include <algorithm>
+# include <functional>
+# include <iterator>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+# include "vector.hpp"
+# include "Utils/Pair.hpp"
+# include "Utils/Relocate.hpp"
+# include "Utils/SortedUnique.hpp"
+# include "Utils/FlatMerge.hpp"
+
+namespace ft
+{
+
+    // Sorted set on top of one contiguous container; see ft::flat_map for the
+    // trade-offs. Iterators are plain pointers into the key array.
+    template<class Key, class Compare = std::less<Key>, class KeyContainer = ft::vector<Key> >
+    class flat_set
+    {
+        public:
+            typedef Key                                     key_type;
+            typedef Key                                     value_type;
+            typedef Compare                                 key_compare;
+            typedef Compare                                 value_compare;
+            typedef KeyContainer                            container_type;
+            typedef const Key&                              reference;
+            typedef const Key&                              const_reference;
+            typedef std::size_t                             size_type;
+            typedef std::ptrdiff_t                          difference_type;
+
+            typedef const Key*                              iterator;
+            typedef const Key*                              const_iterator;
+            typedef std::reverse_iterator<iterator>         reverse_iterator;
+            typedef std::reverse_iterator<const_iterator>   const_reverse_iterator;
+
+        private:
+            container_type      keys;
+            key_compare         comp;
+
+        public:
+            explicit flat_set( const Compare& comp = Compare() ): keys(), comp(comp) {}
+            flat_set( const flat_set &other ): keys(other.keys), comp(other.comp) {}
+
+            template< class InputIt >
+            flat_set( InputIt first, InputIt last, const Compare& comp = Compare() ): keys(), comp(comp)
+            {
+                this->insert(first, last);
+            }
+
+            template< class InputIt >
+            flat_set( sorted_unique_t, InputIt first, InputIt last, const Compare& comp = Compare() ): keys(), comp(comp)
+            {
+                this->insert(sorted_unique, first, last);
+            }
+
+            flat_set( sorted_unique_t, const container_type &k, const Compare& comp = Compare() ): keys(k), comp(comp) {}
+
+            ~flat_set() {}
+
+            flat_set &operator=(const flat_set &other);
+
+# if __cplusplus >= 201103L
+            flat_set( flat_set &&other ): keys(std::move(other.keys)), comp(other.comp) {}
+            flat_set &operator=(flat_set &&other);
+# endif
+
+            //Iterators
+            iterator                begin() const { return this->keys.data(); }
+            iterator                end() const { return this->keys.data() + this->keys.size(); }
+            reverse_iterator        rbegin() const { return reverse_iterator(this->end()); }
+            reverse_iterator        rend() const { return reverse_iterator(this->begin()); }
+
+            //Capacity
+            bool        empty() const { return this->keys.empty(); }
+            size_type   size() const { return this->keys.size(); }
+            size_type   max_size() const { return this->keys.max_size(); }
+            void        reserve(size_type n) { this->keys.reserve(n); }
+
+            //Modifiers
+            pair<iterator, bool>    insert(const value_type &value);
+            iterator                insert(iterator position, const value_type &value);
+            void                    erase(iterator position);
+            size_type               erase(const key_type &value);
+            void                    erase(iterator first, iterator last);
+            void                    swap(flat_set &x);
+            void                    clear() { this->keys.clear(); }
+
+# if __cplusplus >= 201103L
+            pair<iterator, bool>    insert(value_type &&value);
+            template <class... Args>
+            pair<iterator, bool>    emplace(Args&&... args)
+            {
+                value_type  value(std::forward<Args>(args)...);
+
+                return this->insertAt(this->lowerBoundIndex(value), value);
+            }
+# endif
+
+            template <class InputIterator>
+            void insert(InputIterator first, InputIterator last)
+            {
+                container_type  batch;
+
+                for (; first != last; ++first)
+                    batch.push_back(*first);
+                this->mergeBatch(batch, false);
+            }
+
+            template <class InputIterator>
+            void insert(sorted_unique_t, InputIterator first, InputIterator last)
+            {
+                container_type  batch;
+
+                for (; first != last; ++first)
+                    batch.push_back(*first);
+                this->mergeBatch(batch, true);
+            }
+
+            //Observers
+            key_compare             key_comp(void) const    { return (comp);}
+            value_compare           value_comp(void) const  { return (comp);}
+            const container_type    &keys_container() const { return this->keys; }
+
+            //Operations
+            iterator            find(const key_type &value) const;
+            size_type           count(const key_type &value) const { return (this->find(value) != this->end()); }
+            iterator            lower_bound(const key_type &key) const { return std::lower_bound(this->begin(), this->end(), key, this->comp); }
+            iterator            upper_bound(const key_type &key) const { return std::upper_bound(this->begin(), this->end(), key, this->comp); }
+
+            pair<iterator, iterator> equal_range(const key_type &k) const
+            {
+                return (pair<iterator, iterator>(this->lower_bound(k), this->upper_bound(k)));
+            }
+
+        private:
+            size_type           lowerBoundIndex(const key_type &key) const { return this->lower_bound(key) - this->begin(); }
+            template <class V>
+            pair<iterator, bool>    insertAt(size_type i, V &value);
+            void                mergeBatch(container_type &batch, bool sorted);
+    };
+
+    template<class Key, class Compare, class KeyContainer >
+    flat_set<Key, Compare, KeyContainer> &flat_set<Key, Compare, KeyContainer>::operator=(const flat_set &other)
+    {
+        if (this == &other)
+            return *this;
+        this->keys = other.keys;
+        this->comp = other.comp;
+        return *this;
+    }
+
+# if __cplusplus >= 201103L
+    template<class Key, class Compare, class KeyContainer >
+    flat_set<Key, Compare, KeyContainer> &flat_set<Key, Compare, KeyContainer>::operator=(flat_set &&other)
+    {
+        if (this != &other)
+        {
+            this->keys = std::move(other.keys);
+            this->comp = other.comp;
+        }
+        return *this;
+    }
+
+    template<class Key, class Compare, class KeyContainer >
+    pair<typename flat_set<Key, Compare, KeyContainer>::iterator, bool> flat_set<Key, Compare, KeyContainer>::insert(value_type &&value)
+    {
+        return this->insertAt(this->lowerBoundIndex(value), value);
+    }
+# endif
+
+    template<class Key, class Compare, class KeyContainer >
+    pair<typename flat_set<Key, Compare, KeyContainer>::iterator, bool> flat_set<Key, Compare, KeyContainer>::insert(const value_type &value)
+    {
+        return this->insertAt(this->lowerBoundIndex(value), value);
+    }
+
+    template<class Key, class Compare, class KeyContainer >
+    typename flat_set<Key, Compare, KeyContainer>::iterator flat_set<Key, Compare, KeyContainer>::insert(iterator position, const value_type &value)
+    {
+        size_type   i = position - this->begin();
+
+        if ((i < this->size() && !this->comp(value, this->keys[i]))
+            || (i > 0 && !this->comp(this->keys[i - 1], value)))
+            return this->insert(value).first;
+        return this->insertAt(i, value).first;
+    }
+
+    template<class Key, class Compare, class KeyContainer >
+    void flat_set<Key, Compare, KeyContainer>::erase(iterator position)
+    {
+        this->keys.erase(this->keys.begin() + (position - this->begin()));
+    }
+
+    template<class Key, class Compare, class KeyContainer >
+    typename flat_set<Key, Compare, KeyContainer>::size_type flat_set<Key, Compare, KeyContainer>::erase(const key_type &value)
+    {
+        iterator    it = this->find(value);
+
+        if (it == this->end())
+            return (0);
+        this->erase(it);
+        return (1);
+    }
+
+    template<class Key, class Compare, class KeyContainer >
+    void flat_set<Key, Compare, KeyContainer>::erase(iterator first, iterator last)
+    {
+        this->keys.erase(this->keys.begin() + (first - this->begin()), this->keys.begin() + (last - this->begin()));
+    }
+
+    template<class Key, class Compare, class KeyContainer >
+    void flat_set<Key, Compare, KeyContainer>::swap(flat_set &x)
+    {
+        this->keys.swap(x.keys);
+        std::swap(this->comp, x.comp);
+    }
+
+    template<class Key, class Compare, class KeyContainer >
+    typename flat_set<Key, Compare, KeyContainer>::iterator flat_set<Key, Compare, KeyContainer>::find(const key_type &value) const
+    {
+        iterator    it = this->lower_bound(value);
+
+        if (it == this->end() || this->comp(value, *it))
+            return this->end();
+        return it;
+    }
+
+    template<class Key, class Compare, class KeyContainer >
+    template <class V>
+    pair<typename flat_set<Key, Compare, KeyContainer>::iterator, bool> flat_set<Key, Compare, KeyContainer>::insertAt(size_type i, V &value)
+    {
+        if (i < this->size() && !this->comp(value, this->keys[i]))
+            return (pair<iterator, bool>(this->begin() + i, false));
+        this->keys.insert(this->keys.begin() + i, moveValue(value));
+        return (pair<iterator, bool>(this->begin() + i, true));
+    }
+
+    template<class Key, class Compare, class KeyContainer >
+    void flat_set<Key, Compare, KeyContainer>::mergeBatch(container_type &batch, bool sorted)
+    {
+        container_type                  mergedKeys;
+        FlatKeyColumns<container_type>  target(this->keys);
+        FlatKeyColumns<container_type>  merged(mergedKeys);
+
+        mergeSortedBatch(target, merged, batch.data(), batch.size(), sorted, this->comp);
+    }
+
+    template<class Key, class Compare, class KeyContainer >
+    void    swap(flat_set<Key, Compare, KeyContainer> &x, flat_set<Key, Compare, KeyContainer> &y)
+    {
+        x.swap(y);
+    }
+
+}
+
+#endif
@@ -2,12 +2,20 @@
 # define FT_MAP_HPP
 
 # include <memory>
+# include <algorithm>
+# include <limits>
+# include <functional>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
 # include "Utils/BidirectionalTreeIterator.hpp"
+# include "Utils/SortedUnique.hpp"
+# include "Utils/AllocTraits.hpp"
 
 namespace ft
 {
 
-    template<class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator< pair<const Key, T> > >
+    template<class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator< pair<const Key, T> >, class Policy = plain_tree_policy >
     class map
     {
         public:
@@ -22,12 +30,13 @@ namespace ft
             typedef const T*                    const_pointer;
             typedef std::size_t                 size_type;
             typedef std::ptrdiff_t              difference_type;
-            typedef TreeNode<value_type>*       node;
+            typedef Policy                      policy_type;
+            typedef TreeNode<value_type, Policy>*   node;
 
-            typedef ft::BidirectionalTreeIterator<TreeNode<value_type> >            iterator;
-            typedef ft::RevBidirectionalTreeIterator<TreeNode<value_type> >         reverse_iterator;
-            typedef ft::BidirectionalTreeIterator<const TreeNode<value_type> >      const_iterator;
-            typedef ft::RevBidirectionalTreeIterator<const TreeNode<value_type> >   const_reverse_iterator;
+            typedef ft::BidirectionalTreeIterator<TreeNode<value_type, Policy> >             iterator;
+            typedef ft::RevBidirectionalTreeIterator<TreeNode<value_type, Policy> >          reverse_iterator;
+            typedef ft::BidirectionalTreeIterator<const TreeNode<value_type, Policy> >       const_iterator;
+            typedef ft::RevBidirectionalTreeIterator<const TreeNode<value_type, Policy> >    const_reverse_iterator;
 
             class value_compare
             {
@@ -49,41 +58,70 @@ namespace ft
             };
 
         private:
+            typedef typename RebindAlloc<Alloc, TreeNode<value_type, Policy> >::type         node_allocator_type;
+
             allocator_type      alloc;
+            node_allocator_type nodeAlloc;
             key_compare         comp;
             node                root;
             node                leftEnd;
             node                rightEnd;
+            node                minNode;
+            node                maxNode;
             size_type           length;
 
         public:
             explicit map( const Compare& comp = Compare(), const Alloc& alloc = Alloc() );
-            map( const map<Key, T> &other );
+            map( const map &other );
 
             template< class InputIt >
             map( InputIt first, InputIt last, const Compare& comp = Compare(), const Alloc& alloc = Alloc() )
             {
                 this->alloc = alloc;
+                this->nodeAlloc = node_allocator_type(alloc);
                 this->comp = comp;
                 this->root = NULL;
                 this->leftEnd = NULL;
                 this->rightEnd = NULL;
+                this->minNode = NULL;
+                this->maxNode = NULL;
                 this->length = 0;
+                this->buildSorted(first, last, true);
                 this->insert(first, last);
             }
 
+            template< class InputIt >
+            map( sorted_unique_t, InputIt first, InputIt last, const Compare& comp = Compare(), const Alloc& alloc = Alloc() )
+            {
+                this->alloc = alloc;
+                this->nodeAlloc = node_allocator_type(alloc);
+                this->comp = comp;
+                this->root = NULL;
+                this->leftEnd = NULL;
+                this->rightEnd = NULL;
+                this->minNode = NULL;
+                this->maxNode = NULL;
+                this->length = 0;
+                this->buildSorted(first, last, false);
+            }
+
             ~map();
 
-            map &operator=(const map<Key, T> &other);
+            map &operator=(const map &other);
+
+# if __cplusplus >= 201103L
+            map( map &&other );
+            map &operator=(map &&other);
+# endif
 
             //Iterators
-            iterator                begin() { return iterator(findMin(this->root)); }
-            const_iterator          begin() const { return const_iterator(findMin(this->root)); }
+            iterator                begin() { return iterator(this->minNode ? this->minNode : this->rightEnd); }
+            const_iterator          begin() const { return const_iterator(this->minNode ? this->minNode : this->rightEnd); }
             iterator                end() { return iterator(this->rightEnd); }
             const_iterator          end() const { return const_iterator(this->rightEnd); }
 
-            reverse_iterator        rbegin() { return reverse_iterator(findMax(this->root)); }
-            const_reverse_iterator  rbegin() const { return const_reverse_iterator(findMax(this->root)); }
+            reverse_iterator        rbegin() { return reverse_iterator(this->maxNode ? this->maxNode : this->leftEnd); }
+            const_reverse_iterator  rbegin() const { return const_reverse_iterator(this->maxNode ? this->maxNode : this->leftEnd); }
             reverse_iterator        rend() { return reverse_iterator(this->leftEnd); }
             const_reverse_iterator  rend() const { return const_reverse_iterator(this->leftEnd); }
 
@@ -91,7 +129,7 @@ namespace ft
 
             bool        empty() const { return (this->length == 0); }
             size_type   size() const { return this->length; }
-            size_type   max_size() const { return (std::numeric_limits<size_type>::max() / sizeof(TreeNode< pair<Key, T> >)); }
+            size_type   max_size() const { return (std::numeric_limits<size_type>::max() / sizeof(TreeNode<value_type, Policy>)); }
 
             //Element access
 			mapped_type &operator[](const key_type& k);
@@ -105,6 +143,22 @@ namespace ft
 			void                    swap(map &x);
 			void                    clear();
 
+            // Join based bulk operations, reusing the existing nodes.
+            // split_at is O(log n) with order_statistic_policy; the plain
+            // policy keeps no subtree sizes and counts the smaller part,
+            // O(min(m, n - m) + log n) for m moved elements.
+            map                     split_at(const key_type &key);
+            void                    merge(map &other);
+            void                    intersect(const map &other);
+            void                    subtract(const map &other);
+
+# if __cplusplus >= 201103L
+            void                    merge(map &&other) { this->merge(other); }
+			pair<iterator, bool>    insert(value_type &&value);
+            template <class... Args>
+			pair<iterator, bool>    emplace(Args&&... args);
+# endif
+
             template <class InputIterator>
 			void insert(InputIterator first, InputIterator last)
 			{
@@ -131,265 +185,758 @@ namespace ft
 
 			pair<const_iterator, const_iterator> equal_range(const key_type &k) const
 			{
-				return (pair<const_iterator, const_iterator>(this->lower_bound(k), this->upper_bound(k)));
+				pair<node, node> range = this->equalRangeNodes(k);
+				return (pair<const_iterator, const_iterator>(const_iterator(range.first), const_iterator(range.second)));
 			}
 			pair<iterator, iterator> equal_range(const key_type &k)
 			{
-				return (pair<iterator, iterator>(this->lower_bound(k), this->upper_bound(k)));
+				pair<node, node> range = this->equalRangeNodes(k);
+				return (pair<iterator, iterator>(iterator(range.first), iterator(range.second)));
 			}
 
+            // Looks up every key of [first, last) and writes one iterator per
+            // key to out, end() for missing keys. findLanes descents advance
+            // in lockstep so that their cache misses overlap.
+            template <class ForwardIt, class OutputIt>
+            OutputIt            find_many(ForwardIt first, ForwardIt last, OutputIt out)
+            {
+                node    found[findLanes];
+
+                while (first != last)
+                {
+                    size_type   n = this->findBatch(first, last, found);
+
+                    for (size_type i = 0; i < n; i++)
+                        *out++ = iterator(found[i]);
+                }
+                return out;
+            }
+
+            template <class ForwardIt, class OutputIt>
+            OutputIt            find_many(ForwardIt first, ForwardIt last, OutputIt out) const
+            {
+                node    found[findLanes];
+
+                while (first != last)
+                {
+                    size_type   n = this->findBatch(first, last, found);
+
+                    for (size_type i = 0; i < n; i++)
+                        *out++ = const_iterator(found[i]);
+                }
+                return out;
+            }
+
+            // Order statistics, only available with order_statistic_policy.
+            iterator            nth(size_type k);
+            const_iterator      nth(size_type k) const;
+            size_type           rank(const key_type &key) const;
+
+        private:
+            static const size_type  findLanes = 8;
+
+            void                makeEnds();
+            void                cloneFrom(const map &other);
+            void                attachEnds();
+            void                detachEnds();
+            void                setRoot(node newRoot);
+            template <class InputIt>
+            void                buildSorted(InputIt &first, InputIt last, bool checkOrder);
+            void                attachNode(node inserted);
+            node                findNode(const key_type &key) const;
+            node                lowerBoundNode(const key_type &key) const;
+            template <class ForwardIt>
+            size_type           findBatch(ForwardIt &first, ForwardIt last, node *found) const;
+            node                upperBoundNode(const key_type &key) const;
+            pair<node, node>    equalRangeNodes(const key_type &key) const;
+
     };
 
-    template<class Key, class T, class Compare, class Alloc >
-    map<Key, T, Compare, Alloc>::map(const Compare& comp, const Alloc& alloc)
+    template<class Key, class T, class Compare, class Alloc, class Policy >
+    map<Key, T, Compare, Alloc, Policy>::map(const Compare& comp, const Alloc& alloc)
     {
         this->alloc = alloc;
+        this->nodeAlloc = node_allocator_type(alloc);
         this->comp = comp;
         this->root = NULL;
         this->leftEnd = NULL;
         this->rightEnd = NULL;
+        this->minNode = NULL;
+        this->maxNode = NULL;
         this->length = 0;
     }
 
-    template <class Key, class T, class Compare, class Alloc >
-    map<Key, T, Compare, Alloc>::map(const map<Key, T> &other)
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    map<Key, T, Compare, Alloc, Policy>::map(const map &other)
     {
 	    this->alloc = other.alloc;
+        this->nodeAlloc = node_allocator_type(other.alloc);
         this->comp = other.comp;
         this->root = NULL;
         this->leftEnd = NULL;
         this->rightEnd = NULL;
+        this->minNode = NULL;
+        this->maxNode = NULL;
         this->length = 0;
-        this->insert(other.begin(), other.end());
+        this->cloneFrom(other);
     }
 
-    template <class Key, class T, class Compare, class Alloc >
-    map<Key, T, Compare, Alloc>::~map()
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    map<Key, T, Compare, Alloc, Policy>::~map()
     {
         this->clear();
     }
 
-    template <class Key, class T, class Compare, class Alloc >
-    map<Key, T, Compare, Alloc> &map<Key, T, Compare, Alloc>::operator=(const map<Key, T> &other)
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    map<Key, T, Compare, Alloc, Policy> &map<Key, T, Compare, Alloc, Policy>::operator=(const map &other)
     {
-        if (this->root)
-            this->clear();
-        this->insert(other.begin(), other.end());
+        if (this == &other)
+            return *this;
+        this->clear();
+        this->comp = other.comp;
+        this->cloneFrom(other);
+        return *this;
     }
 
-    template <class Key, class T, class Compare, class Alloc >
-    typename map<Key, T, Compare, Alloc>::mapped_type &map<Key, T, Compare, Alloc>::operator[](const key_type& k)
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    typename map<Key, T, Compare, Alloc, Policy>::mapped_type &map<Key, T, Compare, Alloc, Policy>::operator[](const key_type& k)
     {
 	    iterator tmp = this->find(k);
 	    if (tmp != this->end())
 	    {
 		    return tmp->second;
 	    }
-	    return (this->insert(make_pair(k, mapped_type())).first->second);
+	    return (this->insert(ft::make_pair(k, mapped_type())).first->second);
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    void map<Key, T, Compare, Alloc, Policy>::makeEnds()
+    {
+        if (this->leftEnd == NULL)
+        {
+            this->leftEnd = createNode(this->nodeAlloc, value_type(), true);
+            this->rightEnd = createNode(this->nodeAlloc, value_type(), true);
+        }
     }
 
-    template <class Key, class T, class Compare, class Alloc >
-    pair<typename map<Key, T, Compare, Alloc>::iterator, bool> map<Key, T, Compare, Alloc>::insert(const value_type &value)
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    void map<Key, T, Compare, Alloc, Policy>::cloneFrom(const map &other)
     {
-        node    minNode;
-        node    maxNode;
+        if (other.root == NULL)
+            return;
+        this->makeEnds();
+        this->root = cloneTree(other.root, (node)NULL, this->nodeAlloc);
+        this->length = other.length;
+        this->attachEnds();
+    }
 
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    void map<Key, T, Compare, Alloc, Policy>::attachEnds()
+    {
+        this->root->parent = NULL;
+        this->minNode = findMin(this->root);
+        this->maxNode = findMax(this->root);
+        this->minNode->left = this->leftEnd;
+        this->maxNode->right = this->rightEnd;
+        this->leftEnd->parent = this->minNode;
+        this->rightEnd->parent = this->maxNode;
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    void map<Key, T, Compare, Alloc, Policy>::detachEnds()
+    {
         if (this->root == NULL)
+            return;
+        this->minNode->left = NULL;
+        this->maxNode->right = NULL;
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    void map<Key, T, Compare, Alloc, Policy>::setRoot(node newRoot)
+    {
+        this->root = newRoot;
+        if (this->root)
+            this->attachEnds();
+        else
         {
-            this->leftEnd = new TreeNode<value_type>(value_type(), true);
-            this->rightEnd = new TreeNode<value_type>(value_type(), true);
+            this->minNode = NULL;
+            this->maxNode = NULL;
         }
-        else
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    template <class InputIt>
+    void map<Key, T, Compare, Alloc, Policy>::buildSorted(InputIt &first, InputIt last, bool checkOrder)
+    {
+        node        head = NULL;
+        node        tail = NULL;
+        size_type   count = 0;
+
+        if (first == last)
+            return;
+        this->makeEnds();
+        try
+        {
+            for (; first != last; ++first)
+            {
+                if (checkOrder && tail && !this->comp(tail->value.first, (*first).first))
+                    break;
+                node    created = createNode(this->nodeAlloc, *first);
+                if (tail)
+                    tail->right = created;
+                else
+                    head = created;
+                tail = created;
+                count++;
+            }
+        }
+        catch (...)
+        {
+            while (head)
+            {
+                node    next = head->right;
+                destroyNode(this->nodeAlloc, head);
+                head = next;
+            }
+            throw;
+        }
+        if (count == 0)
+            return;
+        this->root = buildBalanced(head, count);
+        this->length = count;
+        this->attachEnds();
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    void map<Key, T, Compare, Alloc, Policy>::attachNode(node inserted)
+    {
+        if (this->length++ == 0)
         {
-            iterator temp = this->find(value.first);
-            if (temp != this->end())
-		        return (make_pair(temp, false));
-            minNode = findMin(this->root);
-            maxNode = findMax(this->root);
-            minNode->left = NULL;
-            maxNode->right = NULL;
+            this->root->left = this->leftEnd;
+            this->root->right = this->rightEnd;
+            this->leftEnd->parent = this->root;
+            this->rightEnd->parent = this->root;
         }
-	    this->length++;
-        this->root = insertNode(this->root, value);
-        this->root = findAllParents(this->root);
-        minNode = findMin(this->root);
-        maxNode = findMax(this->root);
-        minNode->left = this->leftEnd;
-        maxNode->right = this->rightEnd;
-	    return (make_pair(iterator(this->find(value.first)), true));
+        if (inserted->left == this->leftEnd)
+            this->minNode = inserted;
+        if (inserted->right == this->rightEnd)
+            this->maxNode = inserted;
     }
 
-    template <class Key, class T, class Compare, class Alloc >
-    typename map<Key, T, Compare, Alloc>::iterator  map<Key, T, Compare, Alloc>::insert(iterator position, const value_type &value)
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    pair<typename map<Key, T, Compare, Alloc, Policy>::iterator, bool> map<Key, T, Compare, Alloc, Policy>::insert(const value_type &value)
     {
-	    (void)position;
-        this->insert(value);
-        return this->find(value.first);
+        this->makeEnds();
+        pair<node, bool>    res = insertNode(this->root, value, this->value_comp(), this->nodeAlloc);
+
+        if (res.second)
+            this->attachNode(res.first);
+        return (ft::make_pair(iterator(res.first), res.second));
     }
 
-    template <class Key, class T, class Compare, class Alloc >
-    void map<Key, T, Compare, Alloc>::erase(iterator position)
+# if __cplusplus >= 201103L
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    map<Key, T, Compare, Alloc, Policy>::map(map &&other):
+    alloc(other.alloc), nodeAlloc(other.nodeAlloc), comp(other.comp), root(other.root),
+    leftEnd(other.leftEnd), rightEnd(other.rightEnd), minNode(other.minNode), maxNode(other.maxNode), length(other.length)
     {
-        if (this->root == NULL)
+        other.root = NULL;
+        other.leftEnd = NULL;
+        other.rightEnd = NULL;
+        other.minNode = NULL;
+        other.maxNode = NULL;
+        other.length = 0;
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    map<Key, T, Compare, Alloc, Policy> &map<Key, T, Compare, Alloc, Policy>::operator=(map &&other)
+    {
+        if (this != &other)
+        {
+            this->clear();
+            this->swap(other);
+        }
+        return *this;
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    pair<typename map<Key, T, Compare, Alloc, Policy>::iterator, bool> map<Key, T, Compare, Alloc, Policy>::insert(value_type &&value)
+    {
+        node    parent;
+        bool    isLeft;
+
+        this->makeEnds();
+        node    found = findInsertPos(this->root, value, this->value_comp(), parent, isLeft);
+        if (found)
+            return (ft::make_pair(iterator(found), false));
+        node    created = emplaceNode(this->nodeAlloc, std::move(value));
+        linkNode(this->root, parent, isLeft, created);
+        this->attachNode(created);
+        return (ft::make_pair(iterator(created), true));
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    template <class... Args>
+    pair<typename map<Key, T, Compare, Alloc, Policy>::iterator, bool> map<Key, T, Compare, Alloc, Policy>::emplace(Args&&... args)
+    {
+        node    parent;
+        bool    isLeft;
+
+        this->makeEnds();
+        node    created = emplaceNode(this->nodeAlloc, std::forward<Args>(args)...);
+        node    found = findInsertPos(this->root, created->value, this->value_comp(), parent, isLeft);
+        if (found)
+        {
+            destroyNode(this->nodeAlloc, created);
+            return (ft::make_pair(iterator(found), false));
+        }
+        linkNode(this->root, parent, isLeft, created);
+        this->attachNode(created);
+        return (ft::make_pair(iterator(created), true));
+    }
+# endif
+
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    typename map<Key, T, Compare, Alloc, Policy>::iterator  map<Key, T, Compare, Alloc, Policy>::insert(iterator position, const value_type &value)
+    {
+        node    hint = position.base();
+        node    parent = NULL;
+        bool    isLeft = false;
+
+        if (this->root == NULL || hint == NULL || hint == this->leftEnd)
+            return this->insert(value).first;
+        if (hint == this->rightEnd)
+        {
+            if (!this->comp(this->maxNode->value.first, value.first))
+                return this->insert(value).first;
+            parent = this->maxNode;
+        }
+        else if (this->comp(value.first, hint->value.first))
+        {
+            node    prev = (hint == this->minNode) ? NULL : treePrevIter(hint);
+
+            if (prev && !this->comp(prev->value.first, value.first))
+                return this->insert(value).first;
+            isLeft = (hint->left == NULL || hint->left->end);
+            parent = isLeft ? hint : prev;
+        }
+        else if (this->comp(hint->value.first, value.first))
+        {
+            node    next = (hint == this->maxNode) ? NULL : treeNextIter(hint);
+
+            if (next && !this->comp(value.first, next->value.first))
+                return this->insert(value).first;
+            isLeft = !(hint->right == NULL || hint->right->end);
+            parent = isLeft ? next : hint;
+        }
+        else
+            return position;
+        node    created = createNode(this->nodeAlloc, value);
+        linkNode(this->root, parent, isLeft, created);
+        this->attachNode(created);
+        return iterator(created);
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    void map<Key, T, Compare, Alloc, Policy>::erase(iterator position)
+    {
+        node    target = position.base();
+        node    newMin = this->minNode;
+        node    newMax = this->maxNode;
+
+        if (this->root == NULL || target == NULL || target->end)
             return;
-        node    minNode = findMin(this->root);
-        node    maxNode = findMax(this->root);
-        minNode->left = NULL;
-        maxNode->right = NULL;
-	    this->root = removeNode(this->root, *position);
+        if (target == this->minNode)
+            newMin = treeNextIter(target);
+        if (target == this->maxNode)
+            newMax = treePrevIter(target);
+        this->minNode->left = NULL;
+        this->maxNode->right = NULL;
+        this->root = removeNode(this->root, target);
+        destroyNode(this->nodeAlloc, target);
         this->length--;
-        this->root = findAllParents(this->root);
-        minNode = findMin(this->root);
-        maxNode = findMax(this->root);
-        minNode->left = this->leftEnd;
-        maxNode->right = this->rightEnd;
+        if (this->root == NULL)
+        {
+            this->minNode = NULL;
+            this->maxNode = NULL;
+            return;
+        }
+        this->minNode = newMin;
+        this->maxNode = newMax;
+        this->minNode->left = this->leftEnd;
+        this->maxNode->right = this->rightEnd;
+        this->leftEnd->parent = this->minNode;
+        this->rightEnd->parent = this->maxNode;
     }
 
-    template <class Key, class T, class Compare, class Alloc >
-    typename map<Key, T, Compare, Alloc>::size_type map<Key, T, Compare, Alloc>::erase(const key_type &value)
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    typename map<Key, T, Compare, Alloc, Policy>::size_type map<Key, T, Compare, Alloc, Policy>::erase(const key_type &value)
     {
-	    size_type i = 0;
-	    iterator item;
-	    while ((item = this->find(value)) != this->end())
-	    {
-		    this->erase(item);
-		    ++i;
-	    }
-	    return (i);
+        iterator    item = this->find(value);
+
+        if (item == this->end())
+            return (0);
+        this->erase(item);
+        return (1);
     }
 
-    template <class Key, class T, class Compare, class Alloc >
-    void map<Key, T, Compare, Alloc>::erase(iterator first, iterator last)
+    // Cuts [first, last) out with two splits and glues the remaining parts
+    // back with one join, then frees the cut subtree without rebalancing:
+    // O(k + log n) instead of k single erases.
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    void map<Key, T, Compare, Alloc, Policy>::erase(iterator first, iterator last)
     {
-	    while (first != last)
-		    this->erase(first++);
+        node    from = first.base();
+        node    to = last.base();
+        node    left;
+        node    mid;
+        node    right;
+
+        if (first == last || this->root == NULL)
+            return;
+        if (from == this->minNode && to == this->rightEnd)
+        {
+            this->length -= destroyTree(this->root, this->nodeAlloc);
+            this->root = NULL;
+            this->minNode = NULL;
+            this->maxNode = NULL;
+            return;
+        }
+        this->detachEnds();
+        splitTree(this->root, from->value, value_compare(this->comp), left, right);
+        if (to == this->rightEnd)
+        {
+            mid = right;
+            right = NULL;
+        }
+        else
+            splitTree(right, to->value, value_compare(this->comp), mid, right);
+        this->length -= destroyTree(mid, this->nodeAlloc);
+        this->setRoot(concatTrees(left, right));
     }
 
-    template <class Key, class T, class Compare, class Alloc >
-    void map<Key, T, Compare, Alloc>::swap(map &x)
+    // Moves every element not ordered before key into the returned map.
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    map<Key, T, Compare, Alloc, Policy> map<Key, T, Compare, Alloc, Policy>::split_at(const key_type &key)
     {
-	    map<Key, T, Compare, Alloc> temp = *this;
-	    *this = x;
-	    x = temp;
+        map     upper(this->comp, this->alloc);
+        node    pivot = this->lowerBoundNode(key);
+        node    left;
+        node    right;
+
+        upper.nodeAlloc = this->nodeAlloc;
+        if (pivot == this->rightEnd)
+            return upper;
+        upper.length = treeCountFrom(pivot, this->length, Policy());
+        upper.makeEnds();
+        this->detachEnds();
+        splitTree(this->root, pivot->value, value_compare(this->comp), left, right);
+        this->length -= upper.length;
+        this->setRoot(left);
+        upper.setRoot(right);
+        return upper;
     }
 
-    template <class Key, class T, class Compare, class Alloc >
-    void map<Key, T, Compare, Alloc>::clear()
+    // Union: elements of other whose key is not in *this move over, the
+    // others stay in other. Nodes are relinked when the node allocators
+    // compare equal and copied one by one otherwise.
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    void map<Key, T, Compare, Alloc, Policy>::merge(map &other)
     {
-        if (this->root)
-	        this->erase(this->begin(), this->end());
+        node        dups = NULL;
+        size_type   dupCount = 0;
+
+        if (this == &other || other.root == NULL)
+            return;
+        if (this->nodeAlloc != other.nodeAlloc)
+        {
+            iterator    it = other.begin();
+
+            while (it != other.end())
+            {
+                if (this->insert(*it).second)
+                    other.erase(it++);
+                else
+                    ++it;
+            }
+            return;
+        }
+        this->makeEnds();
+        this->detachEnds();
+        other.detachEnds();
+        this->setRoot(unionTrees(this->root, other.root, value_compare(this->comp), dups, dupCount));
+        this->length += other.length - dupCount;
+        other.length = dupCount;
+        other.setRoot(buildBalanced(dups, dupCount));
+    }
+
+    // Keeps only the elements whose key is also in other.
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    void map<Key, T, Compare, Alloc, Policy>::intersect(const map &other)
+    {
+        size_type   removed = 0;
+
+        if (this == &other || this->root == NULL)
+            return;
+        this->detachEnds();
+        this->setRoot(intersectTrees(this->root, other.root, value_compare(this->comp), this->nodeAlloc, removed));
+        this->length -= removed;
+    }
+
+    // Drops every element whose key is in other.
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    void map<Key, T, Compare, Alloc, Policy>::subtract(const map &other)
+    {
+        size_type   removed = 0;
+
+        if (this == &other)
+        {
+            this->erase(this->begin(), this->end());
+            return;
+        }
+        if (this->root == NULL)
+            return;
+        this->detachEnds();
+        this->setRoot(subtractTrees(this->root, other.root, value_compare(this->comp), this->nodeAlloc, removed));
+        this->length -= removed;
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    void map<Key, T, Compare, Alloc, Policy>::swap(map &x)
+    {
+        std::swap(this->alloc, x.alloc);
+        std::swap(this->nodeAlloc, x.nodeAlloc);
+        std::swap(this->comp, x.comp);
+        std::swap(this->root, x.root);
+        std::swap(this->leftEnd, x.leftEnd);
+        std::swap(this->rightEnd, x.rightEnd);
+        std::swap(this->minNode, x.minNode);
+        std::swap(this->maxNode, x.maxNode);
+        std::swap(this->length, x.length);
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    void map<Key, T, Compare, Alloc, Policy>::clear()
+    {
+        destroyTree(this->root, this->nodeAlloc);
         if (this->leftEnd)
-            delete this->leftEnd;
+            destroyNode(this->nodeAlloc, this->leftEnd);
         if (this->rightEnd)
-            delete this->rightEnd;
+            destroyNode(this->nodeAlloc, this->rightEnd);
         this->root = NULL;
         this->leftEnd = NULL;
         this->rightEnd = NULL;
+        this->minNode = NULL;
+        this->maxNode = NULL;
+        this->length = 0;
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    typename map<Key, T, Compare, Alloc, Policy>::iterator map<Key, T, Compare, Alloc, Policy>::find(const key_type &value)
+    {
+        node    found = this->findNode(value);
+
+        if (found)
+            return iterator(found);
+        return (this->end());
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    typename map<Key, T, Compare, Alloc, Policy>::const_iterator map<Key, T, Compare, Alloc, Policy>::find(const key_type &value) const
+    {
+        node    found = this->findNode(value);
+
+        if (found)
+            return const_iterator(found);
+        return (this->end());
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    typename map<Key, T, Compare, Alloc, Policy>::size_type map<Key, T, Compare, Alloc, Policy>::count(const key_type &value) const
+    {
+        node    tempNode = this->lowerBoundNode(value);
+
+        if (tempNode != NULL && !tempNode->end && !this->comp(value, tempNode->value.first))
+            return (1);
+        return (0);
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    typename map<Key, T, Compare, Alloc, Policy>::iterator map<Key, T, Compare, Alloc, Policy>::lower_bound(const key_type &key)
+    {
+        return iterator(this->lowerBoundNode(key));
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    typename map<Key, T, Compare, Alloc, Policy>::const_iterator map<Key, T, Compare, Alloc, Policy>::lower_bound(const key_type &key) const
+    {
+        return const_iterator(this->lowerBoundNode(key));
     }
 
-    template <class Key, class T, class Compare, class Alloc >
-    typename map<Key, T, Compare, Alloc>::iterator map<Key, T, Compare, Alloc>::find(const key_type &value)
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    typename map<Key, T, Compare, Alloc, Policy>::iterator map<Key, T, Compare, Alloc, Policy>::upper_bound(const key_type &key)
+    {
+        return iterator(this->upperBoundNode(key));
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    typename map<Key, T, Compare, Alloc, Policy>::const_iterator map<Key, T, Compare, Alloc, Policy>::upper_bound(const key_type &key) const
+    {
+        return const_iterator(this->upperBoundNode(key));
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    typename map<Key, T, Compare, Alloc, Policy>::node map<Key, T, Compare, Alloc, Policy>::lowerBoundNode(const key_type &key) const
+    {
+        node    tempNode = this->root;
+        node    result = this->rightEnd;
+
+        while (tempNode != NULL && !tempNode->end)
+        {
+            tempNode = lowerBoundStep(tempNode, key, this->comp, result);
+        }
+        return (result);
+    }
+
+    // Early-exit descent with two comparator calls per level. Both children
+    // are prefetched before the comparisons decide between them, so the
+    // load of the next level starts one step earlier.
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    typename map<Key, T, Compare, Alloc, Policy>::node map<Key, T, Compare, Alloc, Policy>::findNode(const key_type &key) const
     {
         node    tempNode = this->root;
 
-	    while (tempNode != NULL)
+        while (tempNode != NULL && !tempNode->end)
         {
-            if (value < tempNode->value.first)
+            prefetchNode(tempNode->left);
+            prefetchNode(tempNode->right);
+            if (this->comp(key, tempNode->value.first))
                 tempNode = tempNode->left;
-            else if (value > tempNode->value.first)
+            else if (this->comp(tempNode->value.first, key))
                 tempNode = tempNode->right;
             else
-                return iterator(tempNode);
+                return (tempNode);
         }
-	    return (this->end());
+        return (NULL);
     }
 
-    template <class Key, class T, class Compare, class Alloc >
-    typename map<Key, T, Compare, Alloc>::const_iterator map<Key, T, Compare, Alloc>::find(const key_type &value) const
+    // Takes up to findLanes keys from first and runs their descents
+    // interleaved, one level of every lane per round, prefetching the node
+    // each lane visits next.
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    template <class ForwardIt>
+    typename map<Key, T, Compare, Alloc, Policy>::size_type map<Key, T, Compare, Alloc, Policy>::findBatch(ForwardIt &first, ForwardIt last, node *found) const
+    {
+        ForwardIt   keys[findLanes];
+        node        current[findLanes];
+        size_type   n = 0;
+        bool        active = true;
+
+        for (; n < findLanes && first != last; ++n, ++first)
+        {
+            keys[n] = first;
+            current[n] = this->root;
+            found[n] = this->rightEnd;
+        }
+        while (active)
+        {
+            active = false;
+            for (size_type i = 0; i < n; i++)
+            {
+                if (current[i] == NULL || current[i]->end)
+                    continue;
+                current[i] = lowerBoundStep(current[i], *keys[i], this->comp, found[i]);
+                prefetchNode(current[i]);
+                active = true;
+            }
+        }
+        for (size_type i = 0; i < n; i++)
+            if (found[i] != this->rightEnd && this->comp(*keys[i], found[i]->value.first))
+                found[i] = this->rightEnd;
+        return n;
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    typename map<Key, T, Compare, Alloc, Policy>::node map<Key, T, Compare, Alloc, Policy>::upperBoundNode(const key_type &key) const
     {
         node    tempNode = this->root;
+        node    result = this->rightEnd;
 
-	    while (tempNode != NULL)
+        while (tempNode != NULL && !tempNode->end)
         {
-            if (value < tempNode->value.first)
+            if (this->comp(key, tempNode->value.first))
+            {
+                result = tempNode;
                 tempNode = tempNode->left;
-            else if (value > tempNode->value.first)
-                tempNode = tempNode->right;
+            }
             else
-                return const_iterator(tempNode);
+                tempNode = tempNode->right;
         }
-	    return (this->end());
+        return (result);
     }
 
-    template <class Key, class T, class Compare, class Alloc >
-    typename map<Key, T, Compare, Alloc>::size_type map<Key, T, Compare, Alloc>::count(const key_type &value) const
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    pair<typename map<Key, T, Compare, Alloc, Policy>::node, typename map<Key, T, Compare, Alloc, Policy>::node>
+    map<Key, T, Compare, Alloc, Policy>::equalRangeNodes(const key_type &key) const
     {
-	    const_iterator it_begin = this->begin();
-	    const_iterator it_end = this->end();
+        node    tempNode = this->root;
+        node    upper = this->rightEnd;
 
-	    while (it_begin != it_end)
-	    {
-		    if ((*it_begin).first == value)
-			    return (1);
-		    ++it_begin;
-	    }
-	    return (0);
+        while (tempNode != NULL && !tempNode->end)
+        {
+            if (this->comp(tempNode->value.first, key))
+                tempNode = tempNode->right;
+            else if (this->comp(key, tempNode->value.first))
+            {
+                upper = tempNode;
+                tempNode = tempNode->left;
+            }
+            else
+                return (ft::make_pair(tempNode, treeNextIter(tempNode)));
+        }
+        return (ft::make_pair(upper, upper));
     }
 
-    template <class Key, class T, class Compare, class Alloc >
-    typename map<Key, T, Compare, Alloc>::iterator map<Key, T, Compare, Alloc>::lower_bound(const key_type &key)
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    typename map<Key, T, Compare, Alloc, Policy>::iterator map<Key, T, Compare, Alloc, Policy>::nth(size_type k)
     {
-	    iterator it_begin = this->begin();
-	    iterator it_end = this->end();
-	    while (it_begin != it_end)
-	    {
-		    if (this->_comp((*it_begin).first, key) <= 0)
-			    return (it_begin);
-		    ++it_begin;
-	    }
-	    return (it_end);
+        if (k >= this->length)
+            return this->end();
+        return iterator(selectNode(this->root, static_cast<difference_type>(k)));
     }
 
-    template <class Key, class T, class Compare, class Alloc >
-    typename map<Key, T, Compare, Alloc>::const_iterator map<Key, T, Compare, Alloc>::lower_bound(const key_type &key) const
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    typename map<Key, T, Compare, Alloc, Policy>::const_iterator map<Key, T, Compare, Alloc, Policy>::nth(size_type k) const
     {
-	    const_iterator it_begin = this->begin();
-	    const_iterator it_end = this->end();
-	    while (it_begin != it_end)
-	    {
-		    if (this->_comp((*it_begin).first, key) <= 0)
-			    return (it_begin);
-		    ++it_begin;
-	    }
-	    return (it_end);
+        if (k >= this->length)
+            return this->end();
+        return const_iterator(selectNode(this->root, static_cast<difference_type>(k)));
     }
 
-    template <class Key, class T, class Compare, class Alloc >
-    typename map<Key, T, Compare, Alloc>::iterator map<Key, T, Compare, Alloc>::upper_bound(const key_type &key)
+    // Number of keys ordered before key.
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    typename map<Key, T, Compare, Alloc, Policy>::size_type map<Key, T, Compare, Alloc, Policy>::rank(const key_type &key) const
     {
-	    iterator it_begin = this->begin();
-	    iterator it_end = this->end();
-	    while (it_begin != it_end)
-	    {
-		    if ((*it_begin).first != key && this->_comp((*it_begin).first, key) <= 0)
-			    return (it_begin);
-		    ++it_begin;
-	    }
-	    return (it_end);
+        node        tempNode = this->root;
+        size_type   result = 0;
+
+        while (tempNode != NULL && !tempNode->end)
+        {
+            if (this->comp(tempNode->value.first, key))
+            {
+                result += subtreeSize(tempNode->left) + 1;
+                tempNode = tempNode->right;
+            }
+            else
+                tempNode = tempNode->left;
+        }
+        return (result);
     }
 
-    template <class Key, class T, class Compare, class Alloc >
-    typename map<Key, T, Compare, Alloc>::const_iterator map<Key, T, Compare, Alloc>::upper_bound(const key_type &key) const
+    template <class Key, class T, class Compare, class Alloc, class Policy >
+    void    swap(map<Key, T, Compare, Alloc, Policy> &x, map<Key, T, Compare, Alloc, Policy> &y)
     {
-	    const_iterator it_begin = this->begin();
-	    const_iterator it_end = this->end();
-	    while (it_begin != it_end)
-	    {
-		    if ((*it_begin).first != key && this->_comp((*it_begin).first, key) <= 0)
-			    return (it_begin);
-		    ++it_begin;
-	    }
-	    return (it_end);
+        x.swap(y);
     }
 
 }
@@ -0,0 +1,454 @@
+#ifndef FT_MAPPED_VECTOR_HPP
+# define FT_MAPPED_VECTOR_HPP
+
+# include <cstddef>
+# include <cstring>
+# include <cerrno>
+# include <string>
+# include <stdexcept>
+# include <algorithm>
+# include <limits>
+# include <new>
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+# if __cplusplus >= 201103L
+#  include <utility>
+#  include <type_traits>
+# endif
+# include "Utils/TypeTraits.hpp"
+# include "Utils/RandomAccessIterator.hpp"
+# include "Utils/GrowthPolicy.hpp"
+
+namespace ft
+{
+
+    // Vector of fixed-size records stored in a memory-mapped file. Opening an
+    // existing file maps it as is: nothing is read or parsed, and processes
+    // that open it read_only share the same page cache pages.
+    //
+    // The file is a 64-byte header (magic, record size, element count)
+    // followed by the raw records. Spare capacity is file space too: growth
+    // extends the file with ftruncate and the mapping with mremap, and
+    // close() trims the file back to size(). The count in the header is only
+    // updated by sync() and close(). T must be trivially copyable and must
+    // not hold pointers; the format follows the host's layout and byte order.
+    //
+    // The trim in close() and shrink_to_fit() shortens the file under every
+    // other mapping of it: a reader that touches a page past the new end
+    // gets SIGBUS. Close writers only once readers are done with the tail,
+    // or reopen readers after a writer closes.
+    template<class T, class Growth = page_growth_policy<> >
+    class mapped_vector
+    {
+# if __cplusplus >= 201103L
+        static_assert(std::is_trivially_copyable<T>::value, "mapped_vector: records must be trivially copyable");
+# elif defined(__GNUC__) || defined(__clang__)
+        typedef char    recordsMustBeTriviallyCopyable[is_trivially_relocatable<T>::value ? 1 : -1];
+# endif
+
+        public:
+            typedef T                   value_type;
+            typedef std::size_t         size_type;
+            typedef std::ptrdiff_t      difference_type;
+            typedef value_type&         reference;
+            typedef const value_type&   const_reference;
+            typedef value_type*         pointer;
+            typedef const value_type*   const_pointer;
+
+            typedef RandomAccessIterator<value_type, reference, pointer>                    iterator;
+            typedef RandomAccessIterator<value_type, const_reference, const_pointer>        const_iterator;
+
+            enum open_mode
+            {
+                read_only,
+                read_write
+            };
+
+        private:
+            struct Header
+            {
+                char        magic[8];
+                size_type   recordSize;
+                size_type   size;
+            };
+
+            static const size_type  headerSize = 64;
+
+            int         fd;
+            bool        writable;
+            char        *base;
+            size_type   mappedBytes;
+            pointer     ptr;
+            size_type   len_size;
+            size_type   cap;
+
+            mapped_vector(const mapped_vector &);
+            mapped_vector   &operator=(const mapped_vector &);
+
+            static const char   *magic() { return "ftmapvec"; }
+            static void         fail(const std::string &what);
+
+            Header      *header() { return reinterpret_cast<Header *>(this->base); }
+            void        mapFile(size_type bytes);
+            void        remapFile(size_type bytes);
+            void        resizeFile(size_type n);
+            void        release();
+            void        checkWritable() const;
+            size_type   grownCapacity(size_type needed) const;
+
+        public:
+            mapped_vector();
+            explicit mapped_vector(const std::string &path, open_mode mode = read_write);
+            ~mapped_vector();
+
+# if __cplusplus >= 201103L
+            mapped_vector(mapped_vector &&x): mapped_vector() { this->swap(x); }
+            mapped_vector   &operator=(mapped_vector &&x)
+            {
+                mapped_vector(std::move(x)).swap(*this);
+                return *this;
+            }
+# endif
+
+            void        open(const std::string &path, open_mode mode = read_write);
+            void        close();
+            void        sync();
+            bool        is_open() const { return this->base != NULL; }
+
+            //Iterators
+            iterator                begin()         { return iterator(this->ptr); }
+            const_iterator          begin() const   { return const_iterator(this->ptr); }
+            iterator                end()           { return iterator(this->ptr + this->len_size); }
+            const_iterator          end() const     { return const_iterator(this->ptr + this->len_size); }
+
+            // --- Capacity ---
+
+            size_type   size() const { return this->len_size; }
+            size_type   max_size() const { return (std::numeric_limits<size_type>::max() - headerSize) / sizeof(value_type); }
+            size_type   capacity() const { return this->cap; }
+            bool        empty() const { return !this->len_size; }
+
+            void        reserve(size_type n);
+            void        resize(size_type n, const value_type &val = value_type());
+            void        shrink_to_fit();
+
+            // --- Element access ---
+
+            reference           operator[](size_type n) { return this->ptr[n]; }
+            const_reference     operator[](size_type n) const { return this->ptr[n]; }
+            reference           front() { return this->ptr[0]; }
+            const_reference     front() const { return this->ptr[0]; }
+            reference           back() { return this->ptr[this->len_size - 1]; }
+            const_reference     back() const { return this->ptr[this->len_size - 1]; }
+            pointer             data() { return this->ptr; }
+            const_pointer       data() const { return this->ptr; }
+            reference           at(size_type n)
+            {
+                if (n < this->len_size)
+                    return this->ptr[n];
+                throw std::out_of_range("mapped_vector");
+            }
+
+            const_reference     at(size_type n) const
+            {
+                if (n < this->len_size)
+                    return this->ptr[n];
+                throw std::out_of_range("mapped_vector");
+            }
+
+            // --- Modifiers ---
+
+            void        push_back(const value_type &val);
+            void        pop_back();
+            void        clear();
+            void        swap(mapped_vector &x);
+    };
+
+    template<class T, class Growth >
+    const typename mapped_vector<T, Growth>::size_type mapped_vector<T, Growth>::headerSize;
+
+    template<class T, class Growth >
+    mapped_vector<T, Growth>::mapped_vector():
+    fd(-1), writable(false), base(NULL), mappedBytes(0), ptr(NULL), len_size(0), cap(0) {}
+
+    template<class T, class Growth >
+    mapped_vector<T, Growth>::mapped_vector(const std::string &path, open_mode mode):
+    fd(-1), writable(false), base(NULL), mappedBytes(0), ptr(NULL), len_size(0), cap(0)
+    {
+        this->open(path, mode);
+    }
+
+    template<class T, class Growth >
+    mapped_vector<T, Growth>::~mapped_vector()
+    {
+        try
+        {
+            this->close();
+        }
+        catch (...)
+        {
+            this->release();
+        }
+    }
+
+    template<class T, class Growth >
+    void    mapped_vector<T, Growth>::fail(const std::string &what)
+    {
+        throw std::runtime_error("mapped_vector: " + what + ": " + std::strerror(errno));
+    }
+
+    template<class T, class Growth >
+    void    mapped_vector<T, Growth>::mapFile(size_type bytes)
+    {
+        int     prot = this->writable ? PROT_READ | PROT_WRITE : PROT_READ;
+        void    *p = ::mmap(NULL, bytes, prot, MAP_SHARED, this->fd, 0);
+
+        if (p == MAP_FAILED)
+            fail("mmap");
+        this->base = static_cast<char *>(p);
+        this->mappedBytes = bytes;
+        this->ptr = reinterpret_cast<pointer>(this->base + headerSize);
+    }
+
+    // Without mremap the old mapping goes first; if the new one then fails,
+    // the vector is closed rather than left with an open file and no mapping.
+    template<class T, class Growth >
+    void    mapped_vector<T, Growth>::remapFile(size_type bytes)
+    {
+# ifdef MREMAP_MAYMOVE
+        void    *p = ::mremap(this->base, this->mappedBytes, bytes, MREMAP_MAYMOVE);
+
+        if (p == MAP_FAILED)
+            fail("mremap");
+        this->base = static_cast<char *>(p);
+        this->mappedBytes = bytes;
+        this->ptr = reinterpret_cast<pointer>(this->base + headerSize);
+# else
+        ::munmap(this->base, this->mappedBytes);
+        this->base = NULL;
+        try
+        {
+            this->mapFile(bytes);
+        }
+        catch (...)
+        {
+            this->release();
+            throw;
+        }
+# endif
+    }
+
+    // Moves the end of the file and of the mapping to n records. The file
+    // grows before the mapping and shrinks after it, so the mapping never
+    // covers pages past the end of the file.
+    template<class T, class Growth >
+    void    mapped_vector<T, Growth>::resizeFile(size_type n)
+    {
+        size_type   bytes = headerSize + n * sizeof(value_type);
+        size_type   oldBytes = this->mappedBytes;
+
+        if (bytes > oldBytes && ::ftruncate(this->fd, bytes) == -1)
+            fail("ftruncate");
+        this->remapFile(bytes);
+        if (bytes < oldBytes && ::ftruncate(this->fd, bytes) == -1)
+            fail("ftruncate");
+        this->cap = n;
+    }
+
+    template<class T, class Growth >
+    void    mapped_vector<T, Growth>::open(const std::string &path, open_mode mode)
+    {
+        struct stat st;
+
+        this->close();
+        this->writable = mode == read_write;
+        this->fd = ::open(path.c_str(), this->writable ? O_RDWR | O_CREAT : O_RDONLY, 0644);
+        if (this->fd == -1)
+            fail(path);
+        try
+        {
+            if (::fstat(this->fd, &st) == -1)
+                fail(path);
+
+            size_type   fileSize = st.st_size;
+            bool        fresh = fileSize == 0 && this->writable;
+
+            if (fresh)
+            {
+                if (::ftruncate(this->fd, headerSize) == -1)
+                    fail(path);
+                fileSize = headerSize;
+            }
+            if (fileSize < headerSize)
+                throw std::runtime_error("mapped_vector: " + path + ": not a mapped_vector file");
+            this->mapFile(fileSize);
+            this->cap = (fileSize - headerSize) / sizeof(value_type);
+            if (fresh)
+            {
+                std::memcpy(this->header()->magic, magic(), sizeof(this->header()->magic));
+                this->header()->recordSize = sizeof(value_type);
+                this->header()->size = 0;
+            }
+            if (std::memcmp(this->header()->magic, magic(), sizeof(this->header()->magic))
+                || this->header()->recordSize != sizeof(value_type)
+                || this->header()->size > this->cap)
+                throw std::runtime_error("mapped_vector: " + path + ": not a mapped_vector file of this type");
+            this->len_size = this->header()->size;
+        }
+        catch (...)
+        {
+            this->release();
+            throw;
+        }
+    }
+
+    template<class T, class Growth >
+    void    mapped_vector<T, Growth>::release()
+    {
+        if (this->base)
+            ::munmap(this->base, this->mappedBytes);
+        if (this->fd != -1)
+            ::close(this->fd);
+        this->fd = -1;
+        this->writable = false;
+        this->base = NULL;
+        this->mappedBytes = 0;
+        this->ptr = NULL;
+        this->len_size = 0;
+        this->cap = 0;
+    }
+
+    // Records the size and trims the spare capacity off the file, see the
+    // class comment about other processes mapping it.
+    template<class T, class Growth >
+    void    mapped_vector<T, Growth>::close()
+    {
+        if (!this->is_open())
+            return;
+        if (this->writable)
+        {
+            this->header()->size = this->len_size;
+            if (this->len_size != this->cap)
+                this->resizeFile(this->len_size);
+        }
+        this->release();
+    }
+
+    // Writes the size and every dirty page back to the file.
+    template<class T, class Growth >
+    void    mapped_vector<T, Growth>::sync()
+    {
+        if (!this->is_open() || !this->writable)
+            return;
+        this->header()->size = this->len_size;
+        if (::msync(this->base, this->mappedBytes, MS_SYNC) == -1)
+            fail("msync");
+    }
+
+    template<class T, class Growth >
+    void    mapped_vector<T, Growth>::checkWritable() const
+    {
+        if (!this->writable)
+            throw std::logic_error("mapped_vector: not open for writing");
+    }
+
+    template<class T, class Growth >
+    typename mapped_vector<T, Growth>::size_type mapped_vector<T, Growth>::grownCapacity(size_type needed) const
+    {
+        if (needed > this->max_size())
+            throw std::length_error("mapped_vector");
+
+        size_type   n = Growth::grow(this->cap, needed, sizeof(value_type));
+
+        return n > this->max_size() ? this->max_size() : n;
+    }
+
+    template<class T, class Growth >
+    void    mapped_vector<T, Growth>::reserve(size_type n)
+    {
+        this->checkWritable();
+        if (n <= this->cap)
+            return;
+        if (n > this->max_size())
+            throw std::length_error("mapped_vector");
+
+        size_type   rounded = Growth::round(n, sizeof(value_type));
+
+        this->resizeFile(rounded > this->max_size() ? n : rounded);
+    }
+
+    template<class T, class Growth >
+    void    mapped_vector<T, Growth>::resize(size_type n, const value_type &val)
+    {
+        value_type  copy(val);
+
+        this->checkWritable();
+        if (n > this->cap)
+            this->reserve(n);
+        for (; this->len_size < n; this->len_size++)
+            new (this->ptr + this->len_size) value_type(copy);
+        this->len_size = n;
+    }
+
+    template<class T, class Growth >
+    void    mapped_vector<T, Growth>::shrink_to_fit()
+    {
+        this->checkWritable();
+        if (this->len_size != this->cap)
+            this->resizeFile(this->len_size);
+    }
+
+    template<class T, class Growth >
+    void    mapped_vector<T, Growth>::push_back(const value_type &val)
+    {
+        this->checkWritable();
+        if (this->len_size == this->cap)
+        {
+            value_type  copy(val);
+
+            this->resizeFile(this->grownCapacity(this->len_size + 1));
+            new (this->ptr + this->len_size) value_type(copy);
+        }
+        else
+            new (this->ptr + this->len_size) value_type(val);
+        this->len_size++;
+    }
+
+    template<class T, class Growth >
+    void    mapped_vector<T, Growth>::pop_back()
+    {
+        this->checkWritable();
+        if (this->len_size)
+            this->len_size--;
+    }
+
+    template<class T, class Growth >
+    void    mapped_vector<T, Growth>::clear()
+    {
+        this->checkWritable();
+        this->len_size = 0;
+    }
+
+    template<class T, class Growth >
+    void    mapped_vector<T, Growth>::swap(mapped_vector &x)
+    {
+        std::swap(this->fd, x.fd);
+        std::swap(this->writable, x.writable);
+        std::swap(this->base, x.base);
+        std::swap(this->mappedBytes, x.mappedBytes);
+        std::swap(this->ptr, x.ptr);
+        std::swap(this->len_size, x.len_size);
+        std::swap(this->cap, x.cap);
+    }
+
+    template<class T, class Growth >
+    void    swap(mapped_vector<T, Growth> &x, mapped_vector<T, Growth> &y)
+    {
+        x.swap(y);
+    }
+
+}
+
+#endif
@@ -0,0 +1,167 @@
+#ifndef FT_MMAP_ALLOCATOR_HPP
+# define FT_MMAP_ALLOCATOR_HPP
+
+# include <cstddef>
+# include <cstring>
+# include <limits>
+# include <new>
+# include <sys/mman.h>
+# include <unistd.h>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+# include "Utils/Relocate.hpp"
+
+namespace ft
+{
+
+    // Allocator for very large arrays. Every block is its own anonymous
+    // mapping, so deallocation hands memory straight back to the system and
+    // reallocate() resizes a block with mremap, moving page table entries
+    // rather than bytes. Blocks of 2 MiB and more are rounded to whole huge
+    // pages and advised with MADV_HUGEPAGE; with HugeTLB they are first
+    // requested from the hugetlbfs pool (MAP_HUGETLB), falling back to
+    // regular pages when the pool is empty.
+    // Each block costs at least a page: use it for arrays that start large,
+    // or together with page_growth_policy.
+    template<class T, bool HugeTLB = false>
+    class mmap_allocator
+    {
+        public:
+            typedef T                   value_type;
+            typedef T                   *pointer;
+            typedef const T             *const_pointer;
+            typedef T                   &reference;
+            typedef const T             &const_reference;
+            typedef std::size_t         size_type;
+            typedef std::ptrdiff_t      difference_type;
+
+            template<class U>
+            struct rebind
+            {
+                typedef mmap_allocator<U, HugeTLB>  other;
+            };
+
+            static const size_type  hugePage = size_type(2) << 20;
+
+        private:
+            static size_type    pageSize()
+            {
+                static size_type    page = ::sysconf(_SC_PAGESIZE);
+
+                return page;
+            }
+
+            // Length of the mapping behind a block of n objects; it only
+            // depends on n, so deallocate and reallocate can recompute it.
+            static size_type    mappedLength(size_type n)
+            {
+                size_type   bytes = n ? n * sizeof(T) : 1;
+                size_type   block = bytes >= hugePage ? hugePage : pageSize();
+
+                return (bytes + block - 1) / block * block;
+            }
+
+            static void     adviseHuge(void *p, size_type length)
+            {
+# ifdef MADV_HUGEPAGE
+                if (length >= hugePage)
+                    ::madvise(p, length, MADV_HUGEPAGE);
+# else
+                (void)p;
+                (void)length;
+# endif
+            }
+
+            static void     *mapBlock(size_type length)
+            {
+                void    *p = MAP_FAILED;
+
+# ifdef MAP_HUGETLB
+                if (HugeTLB && length >= hugePage)
+                    p = ::mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+# endif
+                if (p == MAP_FAILED)
+                    p = ::mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (p == MAP_FAILED)
+                    throw std::bad_alloc();
+                adviseHuge(p, length);
+                return p;
+            }
+
+        public:
+            mmap_allocator() {}
+            mmap_allocator(const mmap_allocator &) {}
+            template<class U>
+            mmap_allocator(const mmap_allocator<U, HugeTLB> &) {}
+            ~mmap_allocator() {}
+
+            mmap_allocator  &operator=(const mmap_allocator &) { return *this; }
+
+            pointer         address(reference x) const { return &x; }
+            const_pointer   address(const_reference x) const { return &x; }
+            size_type       max_size() const { return (std::numeric_limits<size_type>::max() - hugePage) / sizeof(T); }
+
+            pointer     allocate(size_type n, const void * = 0)
+            {
+                if (n > this->max_size())
+                    throw std::bad_alloc();
+                return static_cast<pointer>(mapBlock(mappedLength(n)));
+            }
+
+            void        deallocate(pointer p, size_type n)
+            {
+                if (p)
+                    ::munmap(static_cast<void *>(p), mappedLength(n));
+            }
+
+            // Resizes a block of oldN objects to newN, keeping the bytes of
+            // the first min(oldN, newN). The block may move.
+            pointer     reallocate(pointer p, size_type oldN, size_type newN)
+            {
+                size_type   oldLength = mappedLength(oldN);
+                size_type   newLength = mappedLength(newN);
+
+                if (oldLength == newLength)
+                    return p;
+                if (newN > this->max_size())
+                    throw std::bad_alloc();
+# ifdef MREMAP_MAYMOVE
+                void    *moved = ::mremap(static_cast<void *>(p), oldLength, newLength, MREMAP_MAYMOVE);
+
+                if (moved != MAP_FAILED)
+                {
+                    adviseHuge(moved, newLength);
+                    return static_cast<pointer>(moved);
+                }
+# endif
+                pointer     temp = this->allocate(newN);
+
+                std::memcpy(static_cast<void *>(temp), static_cast<const void *>(p), (oldN < newN ? oldN : newN) * sizeof(T));
+                this->deallocate(p, oldN);
+                return temp;
+            }
+
+# if __cplusplus >= 201103L
+            template<class U, class... Args>
+            void        construct(U *p, Args&&... args) { new (p) U(std::forward<Args>(args)...); }
+# else
+            void        construct(pointer p, const_reference val) { new (p) T(val); }
+# endif
+            void        destroy(pointer p) { p->~T(); }
+
+            template<class U>
+            bool    operator==(const mmap_allocator<U, HugeTLB> &) const { return true; }
+            template<class U>
+            bool    operator!=(const mmap_allocator<U, HugeTLB> &) const { return false; }
+    };
+
+    template<class T, bool HugeTLB>
+    const typename mmap_allocator<T, HugeTLB>::size_type mmap_allocator<T, HugeTLB>::hugePage;
+
+    template<class T, bool HugeTLB>
+    struct has_reallocate< mmap_allocator<T, HugeTLB> >: true_type {};
+
+}
+
+#endif
@@ -0,0 +1,177 @@
+#ifndef FT_NODE_POOL_ALLOCATOR_HPP
+# define FT_NODE_POOL_ALLOCATOR_HPP
+
+# include <cstddef>
+# include <limits>
+# include <new>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+
+namespace ft
+{
+
+    // Single-object allocator for node based containers: nodes are carved out
+    // of slabs of BlockCount slots and recycled through an intrusive free list.
+    // Requests for more than one object go straight to operator new.
+    // Copies share the same pool (reference counted, not thread safe); slabs are
+    // released when the last copy goes away.
+    template<class T, std::size_t BlockCount = 1024>
+    class node_pool_allocator
+    {
+        public:
+            typedef T                   value_type;
+            typedef T                   *pointer;
+            typedef const T             *const_pointer;
+            typedef T                   &reference;
+            typedef const T             &const_reference;
+            typedef std::size_t         size_type;
+            typedef std::ptrdiff_t      difference_type;
+
+            template<class U>
+            struct rebind
+            {
+                typedef node_pool_allocator<U, BlockCount>  other;
+            };
+
+        private:
+            struct Slot
+            {
+                Slot    *next;
+            };
+
+            struct Pool
+            {
+                Slot        *freeList;
+                Slot        *slabs;
+                size_type   refs;
+            };
+
+            struct AlignOf
+            {
+                char    c;
+                T       t;
+            };
+
+            Pool    *pool;
+
+            template<class U, std::size_t N>
+            friend class node_pool_allocator;
+
+            static size_type    slotSize()
+            {
+                size_type   align = sizeof(AlignOf) - sizeof(T);
+                size_type   size = sizeof(T) > sizeof(Slot) ? sizeof(T) : sizeof(Slot);
+
+                if (align < sizeof(Slot))
+                    align = sizeof(Slot);
+                return ((size + align - 1) / align) * align;
+            }
+
+            static Pool     *createPool()
+            {
+                Pool    *p = new Pool;
+
+                p->freeList = NULL;
+                p->slabs = NULL;
+                p->refs = 1;
+                return p;
+            }
+
+            void    release()
+            {
+                if (--this->pool->refs)
+                    return;
+                while (this->pool->slabs)
+                {
+                    Slot    *next = this->pool->slabs->next;
+                    ::operator delete(this->pool->slabs);
+                    this->pool->slabs = next;
+                }
+                delete this->pool;
+            }
+
+            void    grow()
+            {
+                size_type   size = slotSize();
+                char        *slab = static_cast<char *>(::operator new(size * (BlockCount + 1)));
+                Slot        *head = reinterpret_cast<Slot *>(slab);
+
+                head->next = this->pool->slabs;
+                this->pool->slabs = head;
+                for (size_type i = BlockCount; i > 0; i--)
+                {
+                    Slot    *slot = reinterpret_cast<Slot *>(slab + i * size);
+                    slot->next = this->pool->freeList;
+                    this->pool->freeList = slot;
+                }
+            }
+
+        public:
+            node_pool_allocator(): pool(createPool()) {}
+            node_pool_allocator(const node_pool_allocator &other): pool(other.pool) { this->pool->refs++; }
+            template<class U>
+            node_pool_allocator(const node_pool_allocator<U, BlockCount> &): pool(createPool()) {}
+            ~node_pool_allocator() { this->release(); }
+
+            node_pool_allocator &operator=(const node_pool_allocator &other)
+            {
+                other.pool->refs++;
+                this->release();
+                this->pool = other.pool;
+                return *this;
+            }
+
+            pointer         address(reference x) const { return &x; }
+            const_pointer   address(const_reference x) const { return &x; }
+            size_type       max_size() const { return std::numeric_limits<size_type>::max() / sizeof(T); }
+
+            pointer     allocate(size_type n, const void * = 0)
+            {
+                if (n != 1)
+                    return static_cast<pointer>(::operator new(n * sizeof(T)));
+                if (!this->pool->freeList)
+                    this->grow();
+                Slot    *slot = this->pool->freeList;
+                this->pool->freeList = slot->next;
+                return reinterpret_cast<pointer>(slot);
+            }
+
+            void        deallocate(pointer p, size_type n)
+            {
+                if (!p)
+                    return;
+                if (n != 1)
+                {
+                    ::operator delete(p);
+                    return;
+                }
+                Slot    *slot = reinterpret_cast<Slot *>(p);
+                slot->next = this->pool->freeList;
+                this->pool->freeList = slot;
+            }
+
+# if __cplusplus >= 201103L
+            template<class U, class... Args>
+            void        construct(U *p, Args&&... args) { new (p) U(std::forward<Args>(args)...); }
+# else
+            void        construct(pointer p, const_reference val) { new (p) T(val); }
+# endif
+            void        destroy(pointer p) { p->~T(); }
+
+            template<class U>
+            bool    operator==(const node_pool_allocator<U, BlockCount> &other) const
+            {
+                return (void *)this->pool == (void *)other.pool;
+            }
+
+            template<class U>
+            bool    operator!=(const node_pool_allocator<U, BlockCount> &other) const
+            {
+                return !(*this == other);
+            }
+    };
+
+}
+
+#endif
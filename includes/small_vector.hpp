@@ -0,0 +1,276 @@
+#ifndef FT_SMALL_VECTOR_HPP
+# define FT_SMALL_VECTOR_HPP
+
+# include <memory>
+# include <algorithm>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+# include "vector.hpp"
+# include "Utils/InlineAllocator.hpp"
+
+namespace ft
+{
+
+    // ft::vector whose first N elements are stored inside the object. The
+    // container reserves its inline buffer up front and only goes to the heap
+    // once it outgrows it. Everything but construction, moves and swap is
+    // ft::vector's own code, through an InlineAllocator.
+    //
+    // The vector base is private: vector::swap and vector's move assignment
+    // hand buffers over as a whole, which would leave a pointer into the
+    // other object's inline storage. Only the rest of the interface is
+    // re-exported.
+    template<class T, std::size_t N, class Alloc = std::allocator<T> >
+    class small_vector: private vector<T, InlineAllocator<T, N, Alloc> >
+    {
+        private:
+            typedef vector<T, InlineAllocator<T, N, Alloc> >    base_type;
+
+        public:
+            typedef typename base_type::value_type              value_type;
+            typedef typename base_type::allocator_type          allocator_type;
+            typedef typename base_type::size_type               size_type;
+            typedef typename base_type::difference_type         difference_type;
+            typedef typename base_type::reference               reference;
+            typedef typename base_type::const_reference         const_reference;
+            typedef typename base_type::pointer                 pointer;
+            typedef typename base_type::const_pointer           const_pointer;
+            typedef typename base_type::iterator                iterator;
+            typedef typename base_type::const_iterator          const_iterator;
+            typedef typename base_type::reverse_iterator        reverse_iterator;
+            typedef typename base_type::const_reverse_iterator  const_reverse_iterator;
+
+            using base_type::begin;
+            using base_type::end;
+            using base_type::rbegin;
+            using base_type::rend;
+
+            using base_type::size;
+            using base_type::max_size;
+            using base_type::capacity;
+            using base_type::empty;
+            using base_type::resise;
+            using base_type::reserve;
+            using base_type::reserve_exact;
+
+            using base_type::operator[];
+            using base_type::front;
+            using base_type::back;
+            using base_type::data;
+            using base_type::at;
+
+            using base_type::assign;
+            using base_type::push_back;
+            using base_type::pop_back;
+            using base_type::insert;
+            using base_type::erase;
+            using base_type::clear;
+# if __cplusplus >= 201103L
+            using base_type::emplace_back;
+            using base_type::emplace;
+# endif
+
+            static const size_type  inline_capacity = N;
+
+            small_vector(): base_type() { this->reserve(N); }
+            explicit small_vector(const Alloc &alloc): base_type(allocator_type(alloc)) { this->reserve(N); }
+            explicit small_vector(size_type n, const value_type &val = value_type(), const Alloc &alloc = Alloc());
+            small_vector(iterator first, iterator last, const Alloc &alloc = Alloc());
+            small_vector(const_iterator first, const_iterator last, const Alloc &alloc = Alloc());
+            small_vector(const small_vector &x);
+            ~small_vector() {}
+
+            small_vector    &operator=(const small_vector &x);
+
+# if __cplusplus >= 201103L
+            small_vector(small_vector &&x);
+            small_vector    &operator=(small_vector &&x);
+# endif
+
+            bool    is_inline() const { return this->ptr == this->alloc.buffer(); }
+            void    swap(small_vector &x);
+            void    shrink_to_fit();
+
+        private:
+            void    takeFrom(small_vector &x);
+            bool    canAdopt(const small_vector &x) const;
+    };
+
+    template<class T, std::size_t N, class Alloc >
+    const typename small_vector<T, N, Alloc>::size_type small_vector<T, N, Alloc>::inline_capacity;
+
+    template<class T, std::size_t N, class Alloc >
+    small_vector<T, N, Alloc>::small_vector(size_type n, const value_type &val, const Alloc &alloc):
+    base_type(allocator_type(alloc))
+    {
+        this->reserve(n > N ? n : N);
+        this->insert(this->end(), n, val);
+    }
+
+    template<class T, std::size_t N, class Alloc >
+    small_vector<T, N, Alloc>::small_vector(iterator first, iterator last, const Alloc &alloc):
+    base_type(allocator_type(alloc))
+    {
+        this->reserve(N);
+        this->assign(first, last);
+    }
+
+    template<class T, std::size_t N, class Alloc >
+    small_vector<T, N, Alloc>::small_vector(const_iterator first, const_iterator last, const Alloc &alloc):
+    base_type(allocator_type(alloc))
+    {
+        this->reserve(N);
+        this->assign(first, last);
+    }
+
+    template<class T, std::size_t N, class Alloc >
+    small_vector<T, N, Alloc>::small_vector(const small_vector &x):
+    base_type(allocator_type(x.alloc.base()))
+    {
+        this->reserve(N);
+        this->assign(x.begin(), x.end());
+    }
+
+    template<class T, std::size_t N, class Alloc >
+    small_vector<T, N, Alloc> &small_vector<T, N, Alloc>::operator=(const small_vector &x)
+    {
+        base_type::operator=(x);
+        return *this;
+    }
+
+    // A heap buffer of x can only change owner when this vector's Alloc
+    // is able to free it. Allocators never propagate, as in ft::vector.
+    template<class T, std::size_t N, class Alloc >
+    bool    small_vector<T, N, Alloc>::canAdopt(const small_vector &x) const
+    {
+        return !x.is_inline() && this->alloc.base() == x.alloc.base();
+    }
+
+    // Steals a heap buffer when the allocators allow it; otherwise the
+    // elements are moved one by one. x ends up empty and inline.
+    template<class T, std::size_t N, class Alloc >
+    void    small_vector<T, N, Alloc>::takeFrom(small_vector &x)
+    {
+        this->clear();
+        if (!this->canAdopt(x))
+        {
+            this->reserve(x.size());
+            for (size_type i = 0; i < x.len_size; i++)
+                this->push_back(moveValue(x.ptr[i]));
+            x.clear();
+            x.shrink_to_fit();
+            return;
+        }
+        if (this->ptr)
+            this->alloc.deallocate(this->ptr, this->cap);
+        this->ptr = x.ptr;
+        this->len_size = x.len_size;
+        this->cap = x.cap;
+        x.ptr = NULL;
+        x.len_size = 0;
+        x.cap = 0;
+        x.reserve(N);
+    }
+
+# if __cplusplus >= 201103L
+    template<class T, std::size_t N, class Alloc >
+    small_vector<T, N, Alloc>::small_vector(small_vector &&x):
+    base_type(allocator_type(x.alloc.base()))
+    {
+        this->reserve(N);
+        this->takeFrom(x);
+    }
+
+    template<class T, std::size_t N, class Alloc >
+    small_vector<T, N, Alloc> &small_vector<T, N, Alloc>::operator=(small_vector &&x)
+    {
+        if (this != &x)
+            this->takeFrom(x);
+        return *this;
+    }
+# endif
+
+    // Two heap buffers from equal allocators are exchanged in O(1);
+    // otherwise the common prefix is swapped element-wise and the tail of
+    // the longer vector moves over.
+    template<class T, std::size_t N, class Alloc >
+    void    small_vector<T, N, Alloc>::swap(small_vector &x)
+    {
+        if (this == &x)
+            return;
+        if (this->canAdopt(x) && x.canAdopt(*this))
+        {
+            std::swap(this->ptr, x.ptr);
+            std::swap(this->len_size, x.len_size);
+            std::swap(this->cap, x.cap);
+            return;
+        }
+
+        small_vector    &longer = this->size() < x.size() ? x : *this;
+        small_vector    &shorter = this->size() < x.size() ? *this : x;
+        size_type       common = shorter.size();
+
+        for (size_type i = 0; i < common; i++)
+            std::swap(longer.ptr[i], shorter.ptr[i]);
+        shorter.reserve(longer.size());
+        for (size_type i = common; i < longer.len_size; i++)
+            shorter.push_back(moveValue(longer.ptr[i]));
+        longer.erase(longer.begin() + common, longer.end());
+    }
+
+    // Never drops below the inline buffer, which elements move back into
+    // once they fit again.
+    template<class T, std::size_t N, class Alloc >
+    void    small_vector<T, N, Alloc>::shrink_to_fit()
+    {
+        if (this->is_inline() || (this->len_size > N && this->len_size == this->cap))
+            return;
+        this->reallocate(this->len_size > N ? this->len_size : N);
+    }
+
+    template<class T, std::size_t N, class Alloc >
+    bool    operator==(const small_vector<T, N, Alloc> &lhs, const small_vector<T, N, Alloc> &rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.data(), lhs.data() + lhs.size(), rhs.data());
+    }
+
+    template<class T, std::size_t N, class Alloc >
+    bool    operator!=(const small_vector<T, N, Alloc> &lhs, const small_vector<T, N, Alloc> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template<class T, std::size_t N, class Alloc >
+    bool    operator<(const small_vector<T, N, Alloc> &lhs, const small_vector<T, N, Alloc> &rhs)
+    {
+        return std::lexicographical_compare(lhs.data(), lhs.data() + lhs.size(), rhs.data(), rhs.data() + rhs.size());
+    }
+
+    template<class T, std::size_t N, class Alloc >
+    bool    operator>(const small_vector<T, N, Alloc> &lhs, const small_vector<T, N, Alloc> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template<class T, std::size_t N, class Alloc >
+    bool    operator<=(const small_vector<T, N, Alloc> &lhs, const small_vector<T, N, Alloc> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template<class T, std::size_t N, class Alloc >
+    bool    operator>=(const small_vector<T, N, Alloc> &lhs, const small_vector<T, N, Alloc> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template<class T, std::size_t N, class Alloc >
+    void    swap(small_vector<T, N, Alloc> &x, small_vector<T, N, Alloc> &y)
+    {
+        x.swap(y);
+    }
+
+}
+
+#endif
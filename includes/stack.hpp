@@ -15,6 +15,9 @@
 
 # include <vector>
 # include <stack>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
 
 namespace ft {
     template <class T, class Container = std::vector<T> >
@@ -29,8 +32,21 @@ namespace ft {
 
         public:
             explicit stack(const container_type &container = container_type()): cont(container) {}
+            stack(const stack &other): cont(other.cont) {}
             ~stack() {}
 
+            stack               &operator=(const stack &other) { this->cont = other.cont; return *this; }
+
+# if __cplusplus >= 201103L
+            explicit stack(container_type &&container): cont(std::move(container)) {}
+            stack(stack &&other): cont(std::move(other.cont)) {}
+
+            stack               &operator=(stack &&other) { this->cont = std::move(other.cont); return *this; }
+            void                push(value_type &&value) { this->cont.push_back(std::move(value)); }
+            template<class... Args>
+            void                emplace(Args&&... args) { this->cont.emplace_back(std::forward<Args>(args)...); }
+# endif
+
             bool                empty() const { return this->cont.empty(); }
             size_type           size() const { return this->cont.size(); }
             value_type          &top() { return this->cont.back(); }
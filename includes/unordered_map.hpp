@@ -0,0 +1,178 @@
+#ifndef FT_UNORDERED_MAP_HPP
+# define FT_UNORDERED_MAP_HPP
+
+# include <memory>
+# include <functional>
+# include <stdexcept>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+# include "Utils/Pair.hpp"
+# include "Utils/Hash.hpp"
+# include "Utils/HashTable.hpp"
+
+namespace ft
+{
+
+    // Hash map with open addressing over 16-byte control groups (see
+    // HashTable). Values live directly in the slot array, so a lookup costs
+    // one group load plus, almost always, a single key comparison. Rehashing
+    // moves values: it invalidates iterators, pointers and references.
+    template<class Key, class T, class Hash = ft::hash<Key>, class KeyEqual = std::equal_to<Key>, class Alloc = std::allocator< pair<const Key, T> > >
+    class unordered_map: private HashTable<pair<const Key, T>, Key, HashKeyOfPair<Key>, Hash, KeyEqual, Alloc>
+    {
+        private:
+            typedef HashTable<pair<const Key, T>, Key, HashKeyOfPair<Key>, Hash, KeyEqual, Alloc>  table_type;
+
+        public:
+            typedef Key                                         key_type;
+            typedef T                                           mapped_type;
+            typedef pair<const Key, T>                          value_type;
+            typedef Hash                                        hasher;
+            typedef KeyEqual                                    key_equal;
+            typedef Alloc                                       allocator_type;
+            typedef value_type&                                 reference;
+            typedef const value_type&                           const_reference;
+            typedef value_type*                                 pointer;
+            typedef const value_type*                           const_pointer;
+            typedef std::size_t                                 size_type;
+            typedef std::ptrdiff_t                              difference_type;
+            typedef typename table_type::iterator               iterator;
+            typedef typename table_type::const_iterator         const_iterator;
+
+            explicit unordered_map( size_type buckets = 0, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(), const Alloc& alloc = Alloc() ):
+                table_type(buckets, hash, equal, alloc) {}
+            unordered_map( const unordered_map &other ): table_type(other) {}
+
+            template< class InputIt >
+            unordered_map( InputIt first, InputIt last, size_type buckets = 0, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(), const Alloc& alloc = Alloc() ):
+                table_type(buckets, hash, equal, alloc)
+            {
+                this->insert(first, last);
+            }
+
+            ~unordered_map() {}
+
+            unordered_map &operator=(const unordered_map &other)
+            {
+                table_type::operator=(other);
+                return *this;
+            }
+
+# if __cplusplus >= 201103L
+            unordered_map( unordered_map &&other ): table_type(std::move(other)) {}
+            unordered_map &operator=(unordered_map &&other)
+            {
+                table_type::operator=(std::move(other));
+                return *this;
+            }
+
+            using table_type::emplace;
+# endif
+
+            //Iterators
+            using table_type::begin;
+            using table_type::end;
+
+            //Capacity
+            using table_type::empty;
+            using table_type::size;
+            using table_type::max_size;
+
+            //Element access
+            mapped_type         &operator[](const key_type& k);
+            mapped_type         &at(const key_type& k);
+            const mapped_type   &at(const key_type& k) const;
+
+            //Modifiers
+            using table_type::insert;
+            using table_type::erase;
+            using table_type::clear;
+            void                swap(unordered_map &x) { this->swapTable(x); }
+
+            //Lookup
+            using table_type::find;
+            using table_type::count;
+            using table_type::equal_range;
+
+            //Bucket interface
+            using table_type::bucket_count;
+            using table_type::load_factor;
+            using table_type::max_load_factor;
+            using table_type::rehash;
+            using table_type::reserve;
+
+            //Observers
+            using table_type::hash_function;
+            using table_type::key_eq;
+            using table_type::get_allocator;
+    };
+
+    template<class Key, class T, class Hash, class KeyEqual, class Alloc >
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::mapped_type &unordered_map<Key, T, Hash, KeyEqual, Alloc>::operator[](const key_type& k)
+    {
+        size_type               hash = this->hashOf(k);
+        pair<size_type, bool>   pos = this->findOrPrepareInsert(k, hash);
+
+        if (pos.second)
+        {
+            value_type  value(k, mapped_type());
+
+            this->constructAt(pos.first, value);
+            this->commitInsert(pos.first, hash);
+        }
+        return this->slotAt(pos.first)->second;
+    }
+
+    template<class Key, class T, class Hash, class KeyEqual, class Alloc >
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::mapped_type &unordered_map<Key, T, Hash, KeyEqual, Alloc>::at(const key_type& k)
+    {
+        iterator    it = this->find(k);
+
+        if (it == this->end())
+            throw std::out_of_range("unordered_map");
+        return it->second;
+    }
+
+    template<class Key, class T, class Hash, class KeyEqual, class Alloc >
+    const typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::mapped_type &unordered_map<Key, T, Hash, KeyEqual, Alloc>::at(const key_type& k) const
+    {
+        const_iterator  it = this->find(k);
+
+        if (it == this->end())
+            throw std::out_of_range("unordered_map");
+        return it->second;
+    }
+
+    template<class Key, class T, class Hash, class KeyEqual, class Alloc >
+    bool    operator==(const unordered_map<Key, T, Hash, KeyEqual, Alloc> &x, const unordered_map<Key, T, Hash, KeyEqual, Alloc> &y)
+    {
+        typedef typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::const_iterator    const_iterator;
+
+        if (x.size() != y.size())
+            return false;
+        for (const_iterator it = x.begin(); it != x.end(); ++it)
+        {
+            const_iterator  other = y.find(it->first);
+
+            if (other == y.end() || !(other->second == it->second))
+                return false;
+        }
+        return true;
+    }
+
+    template<class Key, class T, class Hash, class KeyEqual, class Alloc >
+    bool    operator!=(const unordered_map<Key, T, Hash, KeyEqual, Alloc> &x, const unordered_map<Key, T, Hash, KeyEqual, Alloc> &y)
+    {
+        return !(x == y);
+    }
+
+    template<class Key, class T, class Hash, class KeyEqual, class Alloc >
+    void    swap(unordered_map<Key, T, Hash, KeyEqual, Alloc> &x, unordered_map<Key, T, Hash, KeyEqual, Alloc> &y)
+    {
+        x.swap(y);
+    }
+
+}
+
+#endif
@@ -0,0 +1,146 @@
+#ifndef FT_UNORDERED_SET_HPP
+# define FT_UNORDERED_SET_HPP
+
+# include <memory>
+# include <functional>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+# include "Utils/Pair.hpp"
+# include "Utils/Hash.hpp"
+# include "Utils/HashTable.hpp"
+
+namespace ft
+{
+
+    // Hash set on the same table as ft::unordered_map. Elements are keys, so
+    // both iterator types are constant.
+    template<class Key, class Hash = ft::hash<Key>, class KeyEqual = std::equal_to<Key>, class Alloc = std::allocator<Key> >
+    class unordered_set: private HashTable<Key, Key, HashKeyOfSelf<Key>, Hash, KeyEqual, Alloc>
+    {
+        private:
+            typedef HashTable<Key, Key, HashKeyOfSelf<Key>, Hash, KeyEqual, Alloc>   table_type;
+
+        public:
+            typedef Key                                         key_type;
+            typedef Key                                         value_type;
+            typedef Hash                                        hasher;
+            typedef KeyEqual                                    key_equal;
+            typedef Alloc                                       allocator_type;
+            typedef const value_type&                           reference;
+            typedef const value_type&                           const_reference;
+            typedef const value_type*                           pointer;
+            typedef const value_type*                           const_pointer;
+            typedef std::size_t                                 size_type;
+            typedef std::ptrdiff_t                              difference_type;
+            typedef typename table_type::const_iterator         iterator;
+            typedef typename table_type::const_iterator         const_iterator;
+
+            explicit unordered_set( size_type buckets = 0, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(), const Alloc& alloc = Alloc() ):
+                table_type(buckets, hash, equal, alloc) {}
+            unordered_set( const unordered_set &other ): table_type(other) {}
+
+            template< class InputIt >
+            unordered_set( InputIt first, InputIt last, size_type buckets = 0, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(), const Alloc& alloc = Alloc() ):
+                table_type(buckets, hash, equal, alloc)
+            {
+                this->insert(first, last);
+            }
+
+            ~unordered_set() {}
+
+            unordered_set &operator=(const unordered_set &other)
+            {
+                table_type::operator=(other);
+                return *this;
+            }
+
+# if __cplusplus >= 201103L
+            unordered_set( unordered_set &&other ): table_type(std::move(other)) {}
+            unordered_set &operator=(unordered_set &&other)
+            {
+                table_type::operator=(std::move(other));
+                return *this;
+            }
+
+            pair<iterator, bool>    insert(value_type &&value) { return table_type::insert(std::move(value)); }
+            template <class... Args>
+            pair<iterator, bool>    emplace(Args&&... args) { return table_type::emplace(std::forward<Args>(args)...); }
+# endif
+
+            //Iterators
+            iterator    begin() const { return table_type::begin(); }
+            iterator    end() const { return table_type::end(); }
+
+            //Capacity
+            using table_type::empty;
+            using table_type::size;
+            using table_type::max_size;
+
+            //Modifiers
+            pair<iterator, bool>    insert(const value_type &value) { return table_type::insert(value); }
+            iterator                insert(const_iterator position, const value_type &value) { return table_type::insert(position, value); }
+            using table_type::erase;
+            using table_type::clear;
+            void                    swap(unordered_set &x) { this->swapTable(x); }
+
+            template <class InputIterator>
+            void insert(InputIterator first, InputIterator last)
+            {
+                table_type::insert(first, last);
+            }
+
+            //Lookup
+            iterator                find(const key_type &key) const { return table_type::find(key); }
+            using table_type::count;
+            pair<iterator, iterator>    equal_range(const key_type &key) const { return table_type::equal_range(key); }
+
+            template <class K>
+            typename enable_if<HashTransparent<Hash, KeyEqual, K>::value, iterator>::type
+            find(const K &key) const { return table_type::find(key); }
+
+            template <class K>
+            typename enable_if<HashTransparent<Hash, KeyEqual, K>::value, pair<iterator, iterator> >::type
+            equal_range(const K &key) const { return table_type::equal_range(key); }
+
+            //Bucket interface
+            using table_type::bucket_count;
+            using table_type::load_factor;
+            using table_type::max_load_factor;
+            using table_type::rehash;
+            using table_type::reserve;
+
+            //Observers
+            using table_type::hash_function;
+            using table_type::key_eq;
+            using table_type::get_allocator;
+    };
+
+    template<class Key, class Hash, class KeyEqual, class Alloc >
+    bool    operator==(const unordered_set<Key, Hash, KeyEqual, Alloc> &x, const unordered_set<Key, Hash, KeyEqual, Alloc> &y)
+    {
+        typedef typename unordered_set<Key, Hash, KeyEqual, Alloc>::const_iterator    const_iterator;
+
+        if (x.size() != y.size())
+            return false;
+        for (const_iterator it = x.begin(); it != x.end(); ++it)
+            if (!y.count(*it))
+                return false;
+        return true;
+    }
+
+    template<class Key, class Hash, class KeyEqual, class Alloc >
+    bool    operator!=(const unordered_set<Key, Hash, KeyEqual, Alloc> &x, const unordered_set<Key, Hash, KeyEqual, Alloc> &y)
+    {
+        return !(x == y);
+    }
+
+    template<class Key, class Hash, class KeyEqual, class Alloc >
+    void    swap(unordered_set<Key, Hash, KeyEqual, Alloc> &x, unordered_set<Key, Hash, KeyEqual, Alloc> &y)
+    {
+        x.swap(y);
+    }
+
+}
+
+#endif
@@ -2,15 +2,25 @@
 # define FT_VECTOR_HPP
 
 # include <memory>
+# include <algorithm>
+# include <limits>
+# include <stdexcept>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
 # include "Utils/RandomAccessIterator.hpp"
+# include "Utils/Relocate.hpp"
+# include "Utils/GrowthPolicy.hpp"
 
 namespace ft {
 
-    template<class T, class Alloc = std::allocator<T> >
+    // Growth decides how capacity evolves, see GrowthPolicy.hpp.
+    template<class T, class Alloc = std::allocator<T>, class Growth = doubling_growth_policy >
     class vector {
         public:
             typedef T                                               value_type;
             typedef Alloc                                           allocator_type;
+            typedef Growth                                          growth_policy;
             typedef size_t                                          size_type;
             typedef ptrdiff_t                                       difference_type;
             typedef value_type&                                     reference;
@@ -26,12 +36,21 @@ namespace ft {
             
 
 
-        private:
+        protected:
             pointer             ptr;
             allocator_type      alloc;
             size_type           len_size;
             size_type           cap;
 
+            void                reallocate(size_type n);
+
+        private:
+            void                destroyRange(pointer first, pointer last);
+            size_type           grownCapacity(size_type needed) const;
+            bool                resizesInPlace() const;
+            pointer             openGap(pointer pos, size_type n);
+            void                closeGap(pointer pos, size_type n);
+
         public:
             explicit    vector(const allocator_type &alloc = allocator_type());
             explicit    vector(size_type n, const value_type &val = value_type(), const allocator_type &alloc = allocator_type());
@@ -42,6 +61,11 @@ namespace ft {
 
             vector &operator=(const vector &x);
 
+# if __cplusplus >= 201103L
+            vector(vector &&x);
+            vector &operator=(vector &&x);
+# endif
+
             //Iterators
 			iterator				begin()			{ return iterator(this->ptr);}
 			const_iterator			begin() const	{ return const_iterator(this->ptr);}
@@ -62,6 +86,8 @@ namespace ft {
 
             void        resise(size_type n, value_type val = value_type());
             void        reserve(size_type n);
+            void        reserve_exact(size_type n);
+            void        shrink_to_fit();
 
             // --- Element access ---
 
@@ -71,6 +97,8 @@ namespace ft {
             const_reference     front() const { return this->ptr[0]; }
             reference           back() { return this->ptr[this->len_size - 1]; }
             const_reference     back() const { return this->ptr[this->len_size - 1]; }
+            pointer             data() { return this->ptr; }
+            const_pointer       data() const { return this->ptr; }
             reference           at(size_type n)
             {
                 if (n < this->len_size)
@@ -101,98 +129,191 @@ namespace ft {
             iterator            erase(iterator first, iterator last);            
             void                swap(vector &x);
             void                clear();
+
+# if __cplusplus >= 201103L
+            void                push_back(value_type &&val);
+            iterator            insert(iterator position, value_type &&val);
+            template<class... Args>
+            void                emplace_back(Args&&... args);
+            template<class... Args>
+            iterator            emplace(iterator position, Args&&... args);
+# endif
     };
 
-    template< typename T, typename Alloc >
-    vector<T, Alloc>::vector(const allocator_type &alloc):
+    template< typename T, typename Alloc, typename Growth >
+    vector<T, Alloc, Growth>::vector(const allocator_type &alloc):
     ptr(NULL), alloc(alloc), len_size(0), cap(0) {}
 
-    template< typename T, typename Alloc >
-    vector<T, Alloc>::vector(size_type n, const value_type &val, const allocator_type &alloc):
-    alloc(alloc), len_size(n), cap(n)
+    template< typename T, typename Alloc, typename Growth >
+    vector<T, Alloc, Growth>::vector(size_type n, const value_type &val, const allocator_type &alloc):
+    ptr(NULL), alloc(alloc), len_size(0), cap(0)
     {
-        this->ptr = new value_type[n]();
-        for (size_type i = 0; i < n; i++)
-		    this->ptr[i] = val;
+        this->reserve(n);
+        for (; this->len_size < n; this->len_size++)
+            allocConstruct(this->alloc, this->ptr + this->len_size, val);
     }
 
-    template<typename T, typename Alloc>
-    vector<T, Alloc>::vector(iterator first, iterator last, const allocator_type &alloc):
-    alloc(alloc), len_size(last - first), cap(last - first)
+    template< typename T, typename Alloc, typename Growth >
+    vector<T, Alloc, Growth>::vector(iterator first, iterator last, const allocator_type &alloc):
+    ptr(NULL), alloc(alloc), len_size(0), cap(0)
     {
-        this->ptr = new value_type[this->cap];
         this->assign(first, last);
     }
 
-    template<typename T, typename Alloc>
-    vector<T, Alloc>::vector(const_iterator first, const_iterator last, const allocator_type &alloc):
-    alloc(alloc), len_size(last - first), cap(last - first)
+    template< typename T, typename Alloc, typename Growth >
+    vector<T, Alloc, Growth>::vector(const_iterator first, const_iterator last, const allocator_type &alloc):
+    ptr(NULL), alloc(alloc), len_size(0), cap(0)
     {
-        this->ptr = new value_type[this->cap];
         this->assign(first, last);
     }
 
-    template< typename T, typename Alloc >
-    vector<T, Alloc>::vector(const vector &x):
-    ptr(x.ptr), alloc(x.alloc), len_size(x.len_size), cap(x.cap) { *this = x; }
+    template< typename T, typename Alloc, typename Growth >
+    vector<T, Alloc, Growth>::vector(const vector &x):
+    ptr(NULL), alloc(x.alloc), len_size(0), cap(0) { *this = x; }
 
-    template< typename T, typename Alloc >
-    vector<T, Alloc>::~vector()
+    template< typename T, typename Alloc, typename Growth >
+    vector<T, Alloc, Growth>::~vector()
     {
+        this->clear();
         if (this->ptr)
         {
-            delete[] this->ptr;
+            this->alloc.deallocate(this->ptr, this->cap);
             this->ptr = NULL;
         }
     }
 
-    template< typename T, typename Alloc >
-    vector<T, Alloc> &vector<T, Alloc>::operator=(const vector<T, Alloc> &x)
+    template< typename T, typename Alloc, typename Growth >
+    vector<T, Alloc, Growth> &vector<T, Alloc, Growth>::operator=(const vector<T, Alloc, Growth> &x)
     {
-        if (this->ptr)
-        {
-            delete[] this->ptr;
-            this->ptr = NULL;
-        }
-        this->ptr = new value_type[x.cap]();
-        this->cap = x.cap;
-        this->len_size = x.len_size;
+        if (this == &x)
+            return *this;
         this->assign(x.begin(), x.end());
         return *this;
     }
 
-    template< typename T, typename Alloc >
-    void    vector<T, Alloc>::resise(size_type n, value_type val)
+    template< typename T, typename Alloc, typename Growth >
+    void    vector<T, Alloc, Growth>::destroyRange(pointer first, pointer last)
+    {
+        if (is_trivially_destructible<value_type>::value)
+            return;
+        for (; first != last; first++)
+            allocDestroy(this->alloc, first);
+    }
+
+    // Whether the allocator can resize the current buffer itself, e.g. with
+    // mremap, instead of the element-wise move to a new one.
+    template< typename T, typename Alloc, typename Growth >
+    bool    vector<T, Alloc, Growth>::resizesInPlace() const
+    {
+        return this->ptr && is_trivially_relocatable<value_type>::value && has_reallocate<allocator_type>::value;
+    }
+
+    template< typename T, typename Alloc, typename Growth >
+    void    vector<T, Alloc, Growth>::reallocate(size_type n)
     {
-        while (n < this->len_size)
-            this->pop_back();
+        if (this->resizesInPlace())
+        {
+            this->ptr = BufferReallocator<has_reallocate<allocator_type>::value>::reallocate(this->alloc, this->ptr, this->cap, n);
+            this->cap = n;
+            return;
+        }
+
+        pointer     temp = this->alloc.allocate(n);
+        size_type   i = 0;
+
+        if (is_trivially_relocatable<value_type>::value)
+            relocate(this->alloc, this->ptr, this->ptr + this->len_size, temp);
+        else
+        {
+            try
+            {
+                for (; i < this->len_size; i++)
+                    allocConstruct(this->alloc, temp + i, moveValue(this->ptr[i]));
+            }
+            catch (...)
+            {
+                this->destroyRange(temp, temp + i);
+                this->alloc.deallocate(temp, n);
+                throw;
+            }
+            this->destroyRange(this->ptr, this->ptr + this->len_size);
+        }
+        if (this->ptr)
+            this->alloc.deallocate(this->ptr, this->cap);
+        this->ptr = temp;
+        this->cap = n;
+    }
+
+    template< typename T, typename Alloc, typename Growth >
+    typename vector<T, Alloc, Growth>::size_type vector<T, Alloc, Growth>::grownCapacity(size_type needed) const
+    {
+        if (needed > this->max_size())
+            throw std::length_error("vector");
+
+        size_type   n = Growth::grow(this->cap, needed, sizeof(value_type));
+
+        return n > this->max_size() ? this->max_size() : n;
+    }
+
+    template< typename T, typename Alloc, typename Growth >
+    void    vector<T, Alloc, Growth>::resise(size_type n, value_type val)
+    {
+        if (n < this->len_size)
+        {
+            this->destroyRange(this->ptr + n, this->ptr + this->len_size);
+            this->len_size = n;
+        }
         if (n > this->cap)
             this->reserve(n);
         while (n > this->len_size)
             this->push_back(val);
     }
 
-    template< typename T, typename Alloc >
-    void    vector<T, Alloc>::reserve(size_type n)
+    template< typename T, typename Alloc, typename Growth >
+    void    vector<T, Alloc, Growth>::reserve(size_type n)
     {
         if (n <= this->cap)
             return;
-        pointer temp = new value_type[n];
-        for (size_type i = 0; i < this->len_size; i++)
-            temp[i] = this->ptr[i];
-        if (this->ptr)
+        if (n > this->max_size())
+            throw std::length_error("vector");
+
+        size_type   rounded = Growth::round(n, sizeof(value_type));
+
+        this->reallocate(rounded > this->max_size() ? n : rounded);
+    }
+
+    // reserve() without the policy's rounding.
+    template< typename T, typename Alloc, typename Growth >
+    void    vector<T, Alloc, Growth>::reserve_exact(size_type n)
+    {
+        if (n <= this->cap)
+            return;
+        if (n > this->max_size())
+            throw std::length_error("vector");
+        this->reallocate(n);
+    }
+
+    // Gives back the unused capacity; an empty vector releases its buffer.
+    template< typename T, typename Alloc, typename Growth >
+    void    vector<T, Alloc, Growth>::shrink_to_fit()
+    {
+        if (this->len_size == this->cap)
+            return;
+        if (this->len_size)
         {
-            delete []   this->ptr;
-            this->ptr = NULL;
+            this->reallocate(this->len_size);
+            return;
         }
-        this->ptr = temp;
-        this->cap = n;
+        this->alloc.deallocate(this->ptr, this->cap);
+        this->ptr = NULL;
+        this->cap = 0;
     }
 
-    template< typename T, typename Alloc >
-    void    vector<T, Alloc>::assign(iterator first, iterator last)
+    template< typename T, typename Alloc, typename Growth >
+    void    vector<T, Alloc, Growth>::assign(iterator first, iterator last)
     {
         this->clear();
+        this->reserve(last - first);
         while (first != last)
         {
             this->push_back(*first);
@@ -200,10 +321,11 @@ namespace ft {
         }
     }
 
-    template< typename T, typename Alloc >
-    void    vector<T, Alloc>::assign(const_iterator first, const_iterator last)
+    template< typename T, typename Alloc, typename Growth >
+    void    vector<T, Alloc, Growth>::assign(const_iterator first, const_iterator last)
     {
         this->clear();
+        this->reserve(last - first);
         while (first != last)
         {
             this->push_back(*first);
@@ -211,157 +333,253 @@ namespace ft {
         }
     }
 
-    template< typename T, typename Alloc >
-    void    vector<T, Alloc>::assign(size_type n, const value_type &val)
+    template< typename T, typename Alloc, typename Growth >
+    void    vector<T, Alloc, Growth>::assign(size_type n, const value_type &val)
     {
         this->clear();
+        this->reserve(n);
         for (size_type i = 0; i < n; i++)
             this->push_back(val);
     }
 
-    template< typename T, typename Alloc >
-    void    vector<T, Alloc>::push_back(const value_type &val)
+    template< typename T, typename Alloc, typename Growth >
+    void    vector<T, Alloc, Growth>::push_back(const value_type &val)
     {
         if (this->len_size == this->cap)
         {
-            if (this->len_size == 0)
-                this->reserve(2);
-            else
-                this->reserve(this->len_size * 2);
+            value_type  copy(val);
+
+            this->reallocate(this->grownCapacity(this->len_size + 1));
+            allocConstruct(this->alloc, this->ptr + this->len_size, moveValue(copy));
         }
-        this->ptr[this->len_size] = val;
+        else
+            allocConstruct(this->alloc, this->ptr + this->len_size, val);
         this->len_size++;
     }
 
-    template< typename T, typename Alloc >
-    void    vector<T, Alloc>::pop_back()
+# if __cplusplus >= 201103L
+    template< typename T, typename Alloc, typename Growth >
+    vector<T, Alloc, Growth>::vector(vector &&x):
+    ptr(x.ptr), alloc(x.alloc), len_size(x.len_size), cap(x.cap)
     {
-        if (this->len_size)
-            this->len_size--;
+        x.ptr = NULL;
+        x.len_size = 0;
+        x.cap = 0;
+    }
+
+    template< typename T, typename Alloc, typename Growth >
+    vector<T, Alloc, Growth> &vector<T, Alloc, Growth>::operator=(vector &&x)
+    {
+        if (this == &x)
+            return *this;
+        vector<T, Alloc, Growth>(std::move(x)).swap(*this);
+        return *this;
+    }
+
+    template< typename T, typename Alloc, typename Growth >
+    void    vector<T, Alloc, Growth>::push_back(value_type &&val)
+    {
+        this->emplace_back(std::move(val));
+    }
+
+    template< typename T, typename Alloc, typename Growth >
+    typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::insert(iterator position, value_type &&val)
+    {
+        return this->emplace(position, std::move(val));
     }
 
-    template< typename T, typename Alloc >
-    typename vector<T, Alloc>::iterator vector<T, Alloc>::insert(iterator position, const value_type &val)
+    template< typename T, typename Alloc, typename Growth >
+    template< class... Args >
+    void    vector<T, Alloc, Growth>::emplace_back(Args&&... args)
     {
-        vector<T, Alloc> temp(position, this->end());
-        this->len_size -= this->end() - position;
-        this->push_back(val);
-        iterator    it_begin = temp.begin();
-        iterator    it_end = temp.end();
-        while (it_begin != it_end)
+        if (this->len_size == this->cap)
         {
-            this->push_back(*it_begin);
-            it_begin++;
+            value_type  tmp(std::forward<Args>(args)...);
+
+            this->reallocate(this->grownCapacity(this->len_size + 1));
+            allocConstruct(this->alloc, this->ptr + this->len_size, std::move(tmp));
         }
+        else
+            allocConstruct(this->alloc, this->ptr + this->len_size, std::forward<Args>(args)...);
+        this->len_size++;
     }
 
-    template< typename T, typename Alloc >
-    void vector<T, Alloc>::insert(iterator position, size_type n, const value_type &val)
+    template< typename T, typename Alloc, typename Growth >
+    template< class... Args >
+    typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::emplace(iterator position, Args&&... args)
     {
-        vector<T, Alloc> temp(position, this->end());
-        this->len_size -= this->end() - position;
-        for (size_type i = 0; i < n; i++)
-            this->push_back(val);
-        iterator    it_begin = temp.begin();
-        iterator    it_end = temp.end();
-        while (it_begin != it_end)
+        size_type   index = position - this->begin();
+        value_type  tmp(std::forward<Args>(args)...);
+        pointer     gap = this->openGap(this->ptr + index, 1);
+
+        try
+        {
+            allocConstruct(this->alloc, gap, std::move(tmp));
+        }
+        catch (...)
         {
-            this->push_back(*it_begin);
-            it_begin++;
+            this->closeGap(gap, 1);
+            throw;
         }
+        return iterator(gap);
     }
+# endif
 
-    template< typename T, typename Alloc >
-    void vector<T, Alloc>::insert(iterator position, iterator first, iterator last)
+    template< typename T, typename Alloc, typename Growth >
+    void    vector<T, Alloc, Growth>::pop_back()
     {
-        vector<T, Alloc> temp(position, this->end());
-        this->len_size -= this->end() - position;
-        while (first != last)
+        if (this->len_size)
         {
-            this->push_back(*first);
-            first++;
+            this->len_size--;
+            allocDestroy(this->alloc, this->ptr + this->len_size);
         }
-        iterator    it_begin = temp.begin();
-        iterator    it_end = temp.end();
-        while (it_begin != it_end)
+    }
+
+    template< typename T, typename Alloc, typename Growth >
+    typename vector<T, Alloc, Growth>::pointer vector<T, Alloc, Growth>::openGap(pointer pos, size_type n)
+    {
+        size_type   index = pos - this->ptr;
+
+        if (this->len_size + n > this->cap && !this->resizesInPlace())
+        {
+            size_type   newCap = this->grownCapacity(this->len_size + n);
+            pointer     temp = this->alloc.allocate(newCap);
+            relocate(this->alloc, this->ptr, pos, temp);
+            relocate(this->alloc, pos, this->ptr + this->len_size, temp + index + n);
+            if (this->ptr)
+                this->alloc.deallocate(this->ptr, this->cap);
+            this->ptr = temp;
+            this->cap = newCap;
+        }
+        else
         {
-            this->push_back(*it_begin);
-            it_begin++;
+            if (this->len_size + n > this->cap)
+                this->reallocate(this->grownCapacity(this->len_size + n));
+            relocate(this->alloc, this->ptr + index, this->ptr + this->len_size, this->ptr + index + n);
         }
+        this->len_size += n;
+        return this->ptr + index;
     }
 
-    template< typename T, typename Alloc >
-    void vector<T, Alloc>::insert(iterator position, const_iterator first, const_iterator last)
+    template< typename T, typename Alloc, typename Growth >
+    void vector<T, Alloc, Growth>::closeGap(pointer pos, size_type n)
     {
-        vector<T, Alloc> temp(position, this->end());
-        this->len_size -= this->end() - position;
-        while (first != last)
+        relocate(this->alloc, pos + n, this->ptr + this->len_size, pos);
+        this->len_size -= n;
+    }
+
+    template< typename T, typename Alloc, typename Growth >
+    typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::insert(iterator position, const value_type &val)
+    {
+        size_type   index = position - this->begin();
+
+        this->insert(position, 1, val);
+        return iterator(this->ptr + index);
+    }
+
+    template< typename T, typename Alloc, typename Growth >
+    void vector<T, Alloc, Growth>::insert(iterator position, size_type n, const value_type &val)
+    {
+        value_type  copy(val);
+        pointer     gap = this->openGap(this->ptr + (position - this->begin()), n);
+        size_type   i = 0;
+
+        try
         {
-            this->push_back(*first);
-            first++;
+            for (; i < n; i++)
+                allocConstruct(this->alloc, gap + i, copy);
         }
-        iterator    it_begin = temp.begin();
-        iterator    it_end = temp.end();
-        while (it_begin != it_end)
+        catch (...)
         {
-            this->push_back(*it_begin);
-            it_begin++;
+            this->destroyRange(gap, gap + i);
+            this->closeGap(gap, n);
+            throw;
         }
     }
 
-    template< typename T, typename Alloc >
-    typename vector<T, Alloc>::iterator vector<T, Alloc>::erase(iterator position)
+    template< typename T, typename Alloc, typename Growth >
+    void vector<T, Alloc, Growth>::insert(iterator position, iterator first, iterator last)
     {
-        iterator temp(position);
-        iterator it_end = this->end() - 1;
-        while (position != it_end)
+        size_type   n = last - first;
+        pointer     gap = this->openGap(this->ptr + (position - this->begin()), n);
+        size_type   i = 0;
+
+        try
+        {
+            for (; i < n; i++, first++)
+                allocConstruct(this->alloc, gap + i, *first);
+        }
+        catch (...)
         {
-            *position = *(position + 1);
-            position++;
+            this->destroyRange(gap, gap + i);
+            this->closeGap(gap, n);
+            throw;
         }
-        this->len_size--;
-        return temp;
     }
 
-    template< typename T, typename Alloc >
-    typename vector<T, Alloc>::iterator vector<T, Alloc>::erase(iterator first, iterator last)
+    template< typename T, typename Alloc, typename Growth >
+    void vector<T, Alloc, Growth>::insert(iterator position, const_iterator first, const_iterator last)
     {
-        iterator temp(last);
-        iterator it_end = this->end();
-        while (last != it_end)
+        size_type   n = last - first;
+        pointer     gap = this->openGap(this->ptr + (position - this->begin()), n);
+        size_type   i = 0;
+
+        try
         {
-            *first = *last;
-            first++;
-            last++;
+            for (; i < n; i++, first++)
+                allocConstruct(this->alloc, gap + i, *first);
+        }
+        catch (...)
+        {
+            this->destroyRange(gap, gap + i);
+            this->closeGap(gap, n);
+            throw;
         }
-        this->len_size -= (last - first);
-        return temp;
     }
 
-    template< typename T, typename Alloc >
-    void    vector<T, Alloc>::swap(vector &x)
+    template< typename T, typename Alloc, typename Growth >
+    typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::erase(iterator position)
+    {
+        return this->erase(position, position + 1);
+    }
+
+    template< typename T, typename Alloc, typename Growth >
+    typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::erase(iterator first, iterator last)
+    {
+        pointer     pos = this->ptr + (first - this->begin());
+        size_type   n = last - first;
+
+        this->destroyRange(pos, pos + n);
+        relocate(this->alloc, pos + n, this->ptr + this->len_size, pos);
+        this->len_size -= n;
+        return iterator(pos);
+    }
+
+    template< typename T, typename Alloc, typename Growth >
+    void    vector<T, Alloc, Growth>::swap(vector &x)
     {
-        vector<T, Alloc> temp = *this;
-        *this = x;
-        x = temp;
+        std::swap(this->ptr, x.ptr);
+        std::swap(this->alloc, x.alloc);
+        std::swap(this->len_size, x.len_size);
+        std::swap(this->cap, x.cap);
     }
 
-    template< typename T, typename Alloc >
-    void vector<T, Alloc>::clear()
+    template< typename T, typename Alloc, typename Growth >
+    void vector<T, Alloc, Growth>::clear()
     {
-        while (this->len_size)
-            this->pop_back();
+        this->destroyRange(this->ptr, this->ptr + this->len_size);
+        this->len_size = 0;
     }
 
     // Non-member function
 
-    template<typename T, typename Alloc>
-    bool    operator==(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs)
+    template< typename T, typename Alloc, typename Growth >
+    bool    operator==(const vector<T, Alloc, Growth> &lhs, const vector<T, Alloc, Growth> &rhs)
     {
-        typename ft::vector<T, Alloc>::const_iterator   begin_lhs = lhs.begin();
-        typename ft::vector<T, Alloc>::const_iterator   begin_rhs = rhs.begin();
-        typename ft::vector<T, Alloc>::const_iterator   end_lhs = lhs.end();
-        typename ft::vector<T, Alloc>::const_iterator   end_rhs = rhs.end();
+        typename ft::vector<T, Alloc, Growth>::const_iterator   begin_lhs = lhs.begin();
+        typename ft::vector<T, Alloc, Growth>::const_iterator   begin_rhs = rhs.begin();
+        typename ft::vector<T, Alloc, Growth>::const_iterator   end_lhs = lhs.end();
+        typename ft::vector<T, Alloc, Growth>::const_iterator   end_rhs = rhs.end();
 
         while ((begin_lhs != end_lhs) && (begin_rhs != end_rhs))
         {
@@ -375,21 +593,21 @@ namespace ft {
         return true;
     }
 
-    template<typename T, typename Alloc>
-    bool    operator!=(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs)
+    template< typename T, typename Alloc, typename Growth >
+    bool    operator!=(const vector<T, Alloc, Growth> &lhs, const vector<T, Alloc, Growth> &rhs)
     {
         if (lhs == rhs)
             return false;
         return true;
     }
 
-    template<typename T, typename Alloc>
-    bool    operator<(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs)
+    template< typename T, typename Alloc, typename Growth >
+    bool    operator<(const vector<T, Alloc, Growth> &lhs, const vector<T, Alloc, Growth> &rhs)
     {
-        typename ft::vector<T, Alloc>::const_iterator   begin_lhs = lhs.begin();
-        typename ft::vector<T, Alloc>::const_iterator   begin_rhs = rhs.begin();
-        typename ft::vector<T, Alloc>::const_iterator   end_lhs = lhs.end();
-        typename ft::vector<T, Alloc>::const_iterator   end_rhs = rhs.end();
+        typename ft::vector<T, Alloc, Growth>::const_iterator   begin_lhs = lhs.begin();
+        typename ft::vector<T, Alloc, Growth>::const_iterator   begin_rhs = rhs.begin();
+        typename ft::vector<T, Alloc, Growth>::const_iterator   end_lhs = lhs.end();
+        typename ft::vector<T, Alloc, Growth>::const_iterator   end_rhs = rhs.end();
 
         while (begin_lhs != end_lhs)
         {
@@ -404,30 +622,28 @@ namespace ft {
         return (begin_rhs != end_rhs);
     }
 
-    template<typename T, typename Alloc>
-    bool    operator>(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs)
+    template< typename T, typename Alloc, typename Growth >
+    bool    operator>(const vector<T, Alloc, Growth> &lhs, const vector<T, Alloc, Growth> &rhs)
     {
         return (rhs < lhs);
     }
 
-    template<typename T, typename Alloc>
-    bool    operator<=(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs)
+    template< typename T, typename Alloc, typename Growth >
+    bool    operator<=(const vector<T, Alloc, Growth> &lhs, const vector<T, Alloc, Growth> &rhs)
     {
         return !(rhs < lhs);
     }
 
-    template<typename T, typename Alloc>
-    bool    operator>=(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs)
+    template< typename T, typename Alloc, typename Growth >
+    bool    operator>=(const vector<T, Alloc, Growth> &lhs, const vector<T, Alloc, Growth> &rhs)
     {
         return !(lhs < rhs);
     }
 
-    template<typename T, typename Alloc>
-    void    swap(vector<T, Alloc> &x, vector<T, Alloc> &y)
+    template< typename T, typename Alloc, typename Growth >
+    void    swap(vector<T, Alloc, Growth> &x, vector<T, Alloc, Growth> &y)
     {
-        vector<T, Alloc> temp = x;
-        x = y;
-        y = temp;
+        x.swap(y);
     }
 
 }
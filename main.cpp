@@ -103,9 +103,9 @@ int main(int argc, char** argv) {
 	}
 	std::cout << "should be constant with the same seed: " << sum << std::endl;
 
-	// {
-	// 	ft::map<int, int> copy = map_int;
-	// }
+	{
+		ft::map<int, int> copy = map_int;
+	}
 	MutantStack<char> iterable_stack;
 	for (char letter = 'a'; letter <= 'z'; letter++)
 		iterable_stack.push(letter);
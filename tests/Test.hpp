@@ -0,0 +1,61 @@
+#ifndef FT_TEST_HPP
+# define FT_TEST_HPP
+
+# include <cstdio>
+# include <cstdlib>
+# include <cstring>
+
+namespace ft_test
+{
+
+    // Minimal registry: every FT_TEST body registers itself at static
+    // initialization and tests/main.cpp runs them in declaration order.
+    typedef void    (*TestFn)();
+
+    struct TestCase
+    {
+        const char  *name;
+        TestFn      fn;
+        TestCase    *next;
+    };
+
+    inline TestCase *&testHead()
+    {
+        static TestCase *head = NULL;
+
+        return head;
+    }
+
+    struct Register
+    {
+        TestCase    self;
+
+        Register(const char *name, TestFn fn)
+        {
+            TestCase    **tail = &testHead();
+
+            self.name = name;
+            self.fn = fn;
+            self.next = NULL;
+            while (*tail)
+                tail = &(*tail)->next;
+            *tail = &self;
+        }
+    };
+
+    inline void fail(const char *file, int line, const char *expr)
+    {
+        std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expr);
+        std::abort();
+    }
+
+}
+
+# define FT_TEST(name) \
+    static void name(); \
+    static ft_test::Register name##Registration(#name, name); \
+    static void name()
+
+# define CHECK(expr) ((expr) ? (void)0 : ft_test::fail(__FILE__, __LINE__, #expr))
+
+#endif
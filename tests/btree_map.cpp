@@ -0,0 +1,163 @@
+#include <map>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include "Test.hpp"
+#include "btree_map.hpp"
+
+namespace
+{
+    typedef std::map<int, std::string>  Ref;
+
+    template<class M>
+    void    checkSame(M &m, const Ref &r)
+    {
+        CHECK(m.size() == r.size());
+
+        Ref::const_iterator ri = r.begin();
+        for (typename M::iterator it = m.begin(); it != m.end(); ++it, ++ri)
+            CHECK(it->first == ri->first && it->second == ri->second);
+        CHECK(ri == r.end());
+
+        Ref::const_reverse_iterator rr = r.rbegin();
+        for (typename M::reverse_iterator it = m.rbegin(); it != m.rend(); ++it, ++rr)
+            CHECK(it->first == rr->first);
+        CHECK(rr == r.rend());
+    }
+
+    // Mixed operations against std::map; small NodeBytes give deep trees
+    // where every erase path splits, borrows and merges.
+    template<class M>
+    void    randomOps(unsigned seed, int ops, int range)
+    {
+        M       m;
+        Ref     r;
+        char    buf[32];
+
+        std::srand(seed);
+        for (int i = 0; i < ops; i++)
+        {
+            int k = std::rand() % range;
+            int op = std::rand() % 10;
+
+            std::sprintf(buf, "v%d", i);
+            if (op < 4)
+                CHECK(m.insert(ft::make_pair(k, std::string(buf))).second == r.insert(std::make_pair(k, std::string(buf))).second);
+            else if (op < 5)
+            {
+                typename M::iterator    hint = std::rand() % 2 ? m.lower_bound(k) : m.end();
+
+                CHECK(m.insert(hint, ft::make_pair(k, std::string(buf)))->first == k);
+                r.insert(std::make_pair(k, std::string(buf)));
+            }
+            else if (op < 7)
+                CHECK(m.erase(k) == r.erase(k));
+            else if (op < 8)
+            {
+                int last = k + std::rand() % (range / 4 + 1);
+
+                m.erase(m.lower_bound(k), m.lower_bound(last));
+                r.erase(r.lower_bound(k), r.lower_bound(last));
+            }
+            else if (op < 9)
+            {
+                CHECK(m.count(k) == r.count(k));
+                CHECK((m.upper_bound(k) == m.end()) == (r.upper_bound(k) == r.end()));
+            }
+            else
+            {
+                m[k] += "x";
+                r[k] += "x";
+            }
+            if (i % 200 == 0)
+                checkSame(m, r);
+        }
+        checkSame(m, r);
+    }
+}
+
+FT_TEST(btree_map_random_ops)
+{
+    randomOps<ft::btree_map<int, std::string, std::less<int>, std::allocator<ft::pair<const int, std::string> >, 16> >(1, 30000, 400);
+    randomOps<ft::btree_map<int, std::string, std::less<int>, std::allocator<ft::pair<const int, std::string> >, 200> >(2, 30000, 2000);
+    randomOps<ft::btree_map<int, std::string> >(3, 30000, 5000);
+}
+
+FT_TEST(btree_map_erase_range)
+{
+    typedef ft::btree_map<int, std::string, std::less<int>, std::allocator<ft::pair<const int, std::string> >, 64>   Map;
+
+    for (int from = 0; from < 600; from += 37)
+    {
+        for (int count = 0; count < 1200; count += 113)
+        {
+            Map m;
+            Ref r;
+
+            for (int i = 0; i < 1000; i++)
+            {
+                m.insert(m.end(), ft::make_pair(i, std::string("a")));
+                r.insert(std::make_pair(i, std::string("a")));
+            }
+            m.erase(m.lower_bound(from), m.lower_bound(from + count));
+            r.erase(r.lower_bound(from), r.lower_bound(from + count));
+            checkSame(m, r);
+        }
+    }
+}
+
+FT_TEST(btree_map_copy_and_swap)
+{
+    typedef ft::btree_map<int, std::string, std::less<int>, std::allocator<ft::pair<const int, std::string> >, 32>   Map;
+
+    Map m;
+    Ref r;
+
+    for (int i = 0; i < 3000; i++)
+    {
+        m[i * 7 % 3001] = "c";
+        r[i * 7 % 3001] = "c";
+    }
+
+    Map copy(m);
+    Map assigned;
+
+    assigned[5] = "gone";
+    assigned = copy;
+    checkSame(copy, r);
+    checkSame(assigned, r);
+
+    Map other;
+
+    other.swap(assigned);
+    checkSame(other, r);
+    CHECK(assigned.empty() && assigned.begin() == assigned.end());
+    m.erase(m.begin(), m.end());
+    CHECK(m.empty());
+    checkSame(copy, r);
+}
+
+# if __cplusplus >= 201703L
+namespace
+{
+    // Allocators honour over-alignment from C++17 on.
+    struct alignas(32) Wide
+    {
+        double  v[4];
+    };
+}
+
+FT_TEST(btree_map_over_aligned_values)
+{
+    ft::btree_map<int, Wide>    m;
+    Wide                        w;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        w.v[0] = i;
+        m.insert(ft::pair<const int, Wide>(i, w));
+    }
+    for (ft::btree_map<int, Wide>::iterator it = m.begin(); it != m.end(); ++it)
+        CHECK(reinterpret_cast<std::size_t>(&it->second) % 32 == 0 && it->second.v[0] == it->first);
+}
+# endif
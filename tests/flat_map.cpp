@@ -0,0 +1,174 @@
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <cstdio>
+#include <cstdlib>
+#include "Test.hpp"
+#include "flat_map.hpp"
+#include "flat_set.hpp"
+
+namespace
+{
+    typedef ft::flat_map<int, std::string>  FlatMap;
+    typedef std::map<int, std::string>      RefMap;
+    typedef ft::flat_set<int>               FlatSet;
+    typedef std::set<int>                   RefSet;
+
+    std::string name(int x)
+    {
+        char    buf[32];
+
+        std::sprintf(buf, "v%d", x);
+        return buf;
+    }
+
+    void    checkSame(const FlatMap &f, const RefMap &r)
+    {
+        CHECK(f.size() == r.size());
+        CHECK(f.keys_container().size() == f.values_container().size());
+
+        FlatMap::const_iterator it = f.begin();
+        for (RefMap::const_iterator ri = r.begin(); ri != r.end(); ++ri, ++it)
+            CHECK(it->first == ri->first && it->second == ri->second);
+        CHECK(it == f.end());
+    }
+
+    void    checkSame(const FlatSet &f, const RefSet &r)
+    {
+        CHECK(f.size() == r.size());
+
+        FlatSet::iterator it = f.begin();
+        for (RefSet::const_iterator ri = r.begin(); ri != r.end(); ++ri, ++it)
+            CHECK(*it == *ri);
+        CHECK(it == f.end());
+    }
+}
+
+FT_TEST(flat_map_random_ops)
+{
+    FlatMap f;
+    RefMap  r;
+
+    std::srand(42);
+    for (int step = 0; step < 10000; step++)
+    {
+        int k = std::rand() % 500;
+        int op = std::rand() % 6;
+
+        if (op == 0)
+            CHECK(f.insert(ft::make_pair(k, name(k))).second == r.insert(std::make_pair(k, name(k))).second);
+        else if (op == 1)
+        {
+            CHECK(f.insert(f.lower_bound(k), ft::make_pair(k, name(k + 1)))->first == k);
+            r.insert(std::make_pair(k, name(k + 1)));
+        }
+        else if (op == 2)
+            CHECK(f.erase(k) == r.erase(k));
+        else if (op == 3)
+        {
+            int last = k + std::rand() % 50;
+
+            f.erase(f.lower_bound(k), f.lower_bound(last));
+            r.erase(r.lower_bound(k), r.lower_bound(last));
+        }
+        else if (op == 4)
+        {
+            f[k] += "x";
+            r[k] += "x";
+        }
+        else
+            CHECK(f.count(k) == r.count(k));
+        if (step % 500 == 0)
+            checkSame(f, r);
+    }
+    checkSame(f, r);
+}
+
+// Range inserts go through the shared batch merge: unsorted batches with
+// repeats, batches that only append, and batches interleaved with the
+// current keys. The first value given for a key wins.
+FT_TEST(flat_range_insert)
+{
+    FlatMap f;
+    RefMap  r;
+    FlatSet fs;
+    RefSet  rs;
+
+    std::srand(7);
+    for (int round = 0; round < 300; round++)
+    {
+        std::vector<ft::pair<int, std::string> >    batch;
+        std::vector<int>                            keys;
+        int                                         base = round % 3 == 0 ? 1000 + round * 40 : 0;
+
+        for (int i = 0; i < 20; i++)
+        {
+            int k = base + std::rand() % (round % 3 == 0 ? 40 : 900);
+
+            batch.push_back(ft::make_pair(k, name(round * 100 + i)));
+            keys.push_back(k);
+            r.insert(std::make_pair(k, name(round * 100 + i)));
+            rs.insert(k);
+        }
+        f.insert(batch.begin(), batch.end());
+        fs.insert(keys.begin(), keys.end());
+        checkSame(f, r);
+        checkSame(fs, rs);
+    }
+
+    std::vector<ft::pair<int, std::string> >    sorted;
+
+    for (int i = 0; i < 100; i++)
+        sorted.push_back(ft::make_pair(100000 + i, name(i)));
+    f.insert(ft::sorted_unique, sorted.begin(), sorted.end());
+    for (int i = 0; i < 100; i++)
+        r.insert(std::make_pair(100000 + i, name(i)));
+    checkSame(f, r);
+}
+
+FT_TEST(flat_map_adopts_containers)
+{
+    ft::vector<int>         keys;
+    ft::vector<std::string> values;
+    RefMap                  r;
+
+    for (int i = 0; i < 50; i++)
+    {
+        int k = (i * 37) % 41;
+
+        keys.push_back(k);
+        values.push_back(name(i));
+        r.insert(std::make_pair(k, name(i)));
+    }
+    checkSame(FlatMap(keys, values), r);
+
+    FlatMap copy(FlatMap(keys, values));
+    FlatMap sorted(ft::sorted_unique, copy.keys_container(), copy.values_container());
+
+    checkSame(sorted, r);
+
+    bool    thrown = false;
+
+    values.pop_back();
+    try
+    {
+        FlatMap bad(keys, values);
+    }
+    catch (std::invalid_argument &)
+    {
+        thrown = true;
+    }
+    CHECK(thrown);
+    thrown = false;
+    try
+    {
+        FlatMap bad(ft::sorted_unique, keys, values);
+    }
+    catch (std::invalid_argument &)
+    {
+        thrown = true;
+    }
+    CHECK(thrown);
+}
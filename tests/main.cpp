@@ -0,0 +1,22 @@
+#include <cstdio>
+#include <cstring>
+#include "Test.hpp"
+
+// Runs every registered test, or only those whose name contains argv[1].
+int main(int argc, char **argv)
+{
+    int run = 0;
+
+    for (ft_test::TestCase *t = ft_test::testHead(); t; t = t->next)
+    {
+        if (argc > 1 && !std::strstr(t->name, argv[1]))
+            continue;
+        std::printf("%-40s", t->name);
+        std::fflush(stdout);
+        t->fn();
+        std::printf("ok\n");
+        run++;
+    }
+    std::printf("%d tests passed\n", run);
+    return 0;
+}
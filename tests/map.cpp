@@ -0,0 +1,149 @@
+#include <map>
+#include <cstdlib>
+#include "Test.hpp"
+#include "map.hpp"
+
+namespace
+{
+    typedef ft::map<int, int>   Map;
+    typedef std::map<int, int>  Ref;
+
+    // Walks the map both ways; the iterators climb parent links, so this
+    // also checks the links kept by insert and erase.
+    void    checkSame(Map &m, const Ref &r)
+    {
+        CHECK(m.size() == r.size());
+        CHECK(m.empty() == r.empty());
+
+        Ref::const_iterator ri = r.begin();
+        for (Map::iterator it = m.begin(); it != m.end(); ++it, ++ri)
+            CHECK(it->first == ri->first && it->second == ri->second);
+        CHECK(ri == r.end());
+
+        Ref::const_reverse_iterator rr = r.rbegin();
+        Map::iterator               it = m.end();
+        while (it != m.begin())
+        {
+            --it;
+            CHECK(it->first == rr->first);
+            ++rr;
+        }
+        CHECK(rr == r.rend());
+    }
+}
+
+FT_TEST(map_insert_erase_random)
+{
+    Map m;
+    Ref r;
+
+    std::srand(42);
+    for (int i = 0; i < 20000; i++)
+    {
+        int k = std::rand() % 3000;
+
+        if (std::rand() % 3)
+            CHECK(m.insert(ft::make_pair(k, i)).second == r.insert(std::make_pair(k, i)).second);
+        else
+            CHECK(m.erase(k) == r.erase(k));
+        if (i % 500 == 0)
+            checkSame(m, r);
+    }
+    checkSame(m, r);
+    while (!r.empty())
+    {
+        int k = r.rbegin()->first;
+
+        r.erase(k);
+        m.erase(m.find(k));
+    }
+    checkSame(m, r);
+}
+
+FT_TEST(map_sequential_insert_erase)
+{
+    Map m;
+    Ref r;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        m[i] = -i;
+        r[i] = -i;
+    }
+    checkSame(m, r);
+    for (int i = 0; i < 10000; i += 2)
+    {
+        m.erase(i);
+        r.erase(i);
+    }
+    checkSame(m, r);
+    CHECK(m.find(2) == m.end() && m.find(3)->second == -3);
+}
+
+namespace
+{
+    bool    sameContents(Map &a, Map &b)
+    {
+        Map::iterator   x = a.begin();
+        Map::iterator   y = b.begin();
+
+        for (; x != a.end() && y != b.end(); ++x, ++y)
+            if (x->first != y->first || x->second != y->second)
+                return false;
+        return x == a.end() && y == b.end();
+    }
+}
+
+FT_TEST(map_copy_and_assign)
+{
+    Map m;
+
+    for (int i = 0; i < 1000; i++)
+        m[(i * 7919) % 1000] = i;
+
+    Map c(m);
+    Map a;
+
+    a[5] = 5;
+    a = m;
+    CHECK(sameContents(c, m) && sameContents(a, m));
+    c.erase(10);
+    CHECK(!sameContents(c, m) && c.size() + 1 == m.size());
+}
+
+FT_TEST(map_hinted_insert)
+{
+    Map m;
+    Ref r;
+
+    std::srand(5);
+    for (int i = 0; i < 20000; i++)
+    {
+        int             k = std::rand() % 3000;
+        int             mode = std::rand() % 4;
+        Map::iterator   hint;
+
+        if (mode == 0)
+            hint = m.end();
+        else if (mode == 1)
+            hint = m.begin();
+        else if (mode == 2)
+            hint = m.lower_bound(k);
+        else
+            hint = m.lower_bound(std::rand() % 3000);
+
+        Map::iterator   it = m.insert(hint, ft::make_pair(k, i));
+
+        r.insert(std::make_pair(k, i));
+        CHECK(it->first == k && it->second == r[k]);
+        if (std::rand() % 3 == 0)
+        {
+            int e = std::rand() % 3000;
+
+            CHECK(m.erase(e) == r.erase(e));
+        }
+        if (i % 1000 == 0)
+            checkSame(m, r);
+    }
+    checkSame(m, r);
+}
@@ -0,0 +1,50 @@
+#include <map>
+#include <functional>
+#include <cstdlib>
+#include "Test.hpp"
+#include "map.hpp"
+
+FT_TEST(map_bounds_match_std)
+{
+    ft::map<int, int>       m;
+    std::map<int, int>      r;
+
+    for (int i = 0; i < 3000; i += 2)
+    {
+        m.insert(ft::make_pair(i, i));
+        r.insert(std::make_pair(i, i));
+    }
+
+    const ft::map<int, int> &cm = m;
+
+    for (int k = -3; k < 3005; k++)
+    {
+        ft::map<int, int>::iterator     lb = m.lower_bound(k);
+        ft::map<int, int>::iterator     ub = m.upper_bound(k);
+        std::map<int, int>::iterator    rlb = r.lower_bound(k);
+        std::map<int, int>::iterator    rub = r.upper_bound(k);
+
+        CHECK((lb == m.end()) == (rlb == r.end()));
+        CHECK(lb == m.end() || lb->first == rlb->first);
+        CHECK((ub == m.end()) == (rub == r.end()));
+        CHECK(ub == m.end() || ub->first == rub->first);
+
+        ft::pair<ft::map<int, int>::iterator, ft::map<int, int>::iterator>  er = m.equal_range(k);
+
+        CHECK(er.first == lb && er.second == ub);
+        CHECK(cm.count(k) == r.count(k));
+    }
+}
+
+FT_TEST(map_bounds_custom_compare)
+{
+    ft::map<int, int, std::greater<int> >   g;
+
+    for (int i = 0; i < 100; i++)
+        g[i] = i;
+    CHECK(g.begin()->first == 99);
+    CHECK(g.lower_bound(50)->first == 50);
+    CHECK(g.upper_bound(50)->first == 49);
+    CHECK(g.count(7) == 1 && g.count(100) == 0);
+    CHECK(g.lower_bound(-1) == g.end());
+}
@@ -0,0 +1,69 @@
+#include <map>
+#include <list>
+#include <vector>
+#include <iterator>
+#include <functional>
+#include <cstdlib>
+#include "Test.hpp"
+#include "map.hpp"
+
+namespace
+{
+    // find and find_many against std::map, on sizes around the lane count
+    // of find_many and with keys that miss below, between and above.
+    template<class Compare>
+    void    findMatchesStd()
+    {
+        typedef ft::map<int, int, Compare>  Map;
+        typedef std::map<int, int, Compare> Ref;
+
+        std::srand(9);
+        for (int n = 0; n < 300; n += 7)
+        {
+            Map                                     m;
+            Ref                                     r;
+            std::list<int>                          keys;
+            std::vector<typename Map::iterator>     found;
+            std::vector<typename Map::const_iterator>   constFound;
+            const Map                               &cm = m;
+
+            for (int i = 0; i < n; i++)
+            {
+                int k = std::rand() % 500;
+
+                m[k] = i;
+                r[k] = i;
+            }
+            for (int i = 0; i < 100; i++)
+                keys.push_back(std::rand() % 520 - 10);
+            m.find_many(keys.begin(), keys.end(), std::back_inserter(found));
+            cm.find_many(keys.begin(), keys.end(), std::back_inserter(constFound));
+            CHECK(found.size() == keys.size() && constFound.size() == keys.size());
+
+            std::size_t i = 0;
+
+            for (std::list<int>::iterator k = keys.begin(); k != keys.end(); ++k, ++i)
+            {
+                typename Ref::iterator  expected = r.find(*k);
+
+                if (expected == r.end())
+                {
+                    CHECK(m.find(*k) == m.end() && cm.find(*k) == cm.end());
+                    CHECK(found[i] == m.end() && constFound[i] == cm.end());
+                }
+                else
+                {
+                    CHECK(m.find(*k)->second == expected->second);
+                    CHECK(found[i]->first == *k && found[i]->second == expected->second);
+                    CHECK(constFound[i] == cm.find(*k));
+                }
+            }
+        }
+    }
+}
+
+FT_TEST(map_find_and_find_many)
+{
+    findMatchesStd<std::less<int> >();
+    findMatchesStd<std::greater<int> >();
+}
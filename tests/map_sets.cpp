@@ -0,0 +1,121 @@
+#include <map>
+#include <cstdlib>
+#include "Test.hpp"
+#include "map.hpp"
+
+namespace
+{
+    typedef std::map<int, int>  Ref;
+
+    template<class M>
+    void    checkSame(M &m, const Ref &r)
+    {
+        typename M::iterator    it = m.begin();
+
+        CHECK(m.size() == r.size());
+        for (Ref::const_iterator ri = r.begin(); ri != r.end(); ++ri, ++it)
+            CHECK(it != m.end() && it->first == ri->first && it->second == ri->second);
+        CHECK(it == m.end());
+    }
+
+    template<class M>
+    void    fill(M &m, Ref &r, int n, int range, int tag)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            int k = std::rand() % range;
+
+            m.insert(ft::make_pair(k, tag));
+            r.insert(std::make_pair(k, tag));
+        }
+    }
+
+    template<class M>
+    void    randomSetOps()
+    {
+        std::srand(11);
+        for (int round = 0; round < 2000; round++)
+        {
+            M   a;
+            M   b;
+            Ref ra;
+            Ref rb;
+            int range = 1 + std::rand() % 500;
+
+            fill(a, ra, std::rand() % 200, range, 1);
+            fill(b, rb, std::rand() % 200, range, 2);
+            switch (std::rand() % 4)
+            {
+                case 0:
+                {
+                    a.merge(b);
+                    for (Ref::iterator i = rb.begin(); i != rb.end();)
+                    {
+                        if (ra.insert(*i).second)
+                            rb.erase(i++);
+                        else
+                            ++i;
+                    }
+                    break;
+                }
+                case 1:
+                {
+                    Ref kept;
+
+                    a.intersect(b);
+                    for (Ref::iterator i = ra.begin(); i != ra.end(); ++i)
+                        if (rb.count(i->first))
+                            kept.insert(*i);
+                    ra = kept;
+                    break;
+                }
+                case 2:
+                {
+                    a.subtract(b);
+                    for (Ref::iterator i = rb.begin(); i != rb.end(); ++i)
+                        ra.erase(i->first);
+                    break;
+                }
+                default:
+                {
+                    int k = std::rand() % (range + 2) - 1;
+
+                    b = a.split_at(k);
+                    rb = Ref(ra.lower_bound(k), ra.end());
+                    ra.erase(ra.lower_bound(k), ra.end());
+                    break;
+                }
+            }
+            checkSame(a, ra);
+            checkSame(b, rb);
+        }
+    }
+}
+
+FT_TEST(map_set_operations)
+{
+    randomSetOps<ft::map<int, int> >();
+}
+
+FT_TEST(map_set_operations_order_statistic)
+{
+    randomSetOps<ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::order_statistic_policy> >();
+}
+
+FT_TEST(map_split_keeps_order_statistics)
+{
+    typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::order_statistic_policy>  OsMap;
+
+    OsMap   m;
+
+    for (int i = 0; i < 10000; i++)
+        m[i] = i;
+
+    OsMap   upper = m.split_at(6000);
+
+    CHECK(m.size() == 6000 && upper.size() == 4000);
+    CHECK(m.nth(5999)->first == 5999 && upper.nth(0)->first == 6000);
+    CHECK(upper.nth(3999)->first == 9999 && upper.rank(8000) == 2000);
+    m.merge(upper);
+    CHECK(m.size() == 10000 && upper.empty() && m.nth(7777)->first == 7777);
+}
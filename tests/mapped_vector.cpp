@@ -0,0 +1,202 @@
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <cstdio>
+#include <cstdlib>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "Test.hpp"
+#include "vector.hpp"
+#include "mapped_vector.hpp"
+#include "mmap_allocator.hpp"
+
+namespace
+{
+    struct Record
+    {
+        int     index;
+        char    payload[100];
+    };
+
+    typedef ft::mapped_vector<Record>   Mapped;
+
+    const char  *testFile = "ft_tests_mapped_vector.dat";
+
+    long    fileSize(const char *path)
+    {
+        struct stat st;
+
+        if (::stat(path, &st) == -1)
+            return -1;
+        return st.st_size;
+    }
+
+    Record  record(int i)
+    {
+        Record  r;
+
+        r.index = i;
+        r.payload[0] = char(i);
+        return r;
+    }
+}
+
+// Grow, close, reopen: the file holds exactly the header and size()
+// records afterwards, and a second read-only mapping sees what sync()
+// published.
+FT_TEST(mapped_vector_round_trip)
+{
+    std::vector<int>    ref;
+
+    ::unlink(testFile);
+    {
+        Mapped  v(testFile);
+
+        CHECK(v.is_open() && v.empty());
+        for (int i = 0; i < 100000; i++)
+        {
+            v.push_back(record(i));
+            ref.push_back(i);
+        }
+        v.pop_back();
+        ref.pop_back();
+        v.sync();
+        CHECK(v.capacity() > v.size());
+
+        Mapped  reader(testFile, Mapped::read_only);
+
+        CHECK(reader.size() == ref.size());
+        for (std::size_t i = 0; i < reader.size(); i++)
+            CHECK(reader[i].index == ref[i]);
+
+        bool    thrown = false;
+
+        try
+        {
+            reader.push_back(record(0));
+        }
+        catch (std::logic_error &)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+    }
+    CHECK(fileSize(testFile) == long(64 + ref.size() * sizeof(Record)));
+    {
+        Mapped  v(testFile);
+
+        CHECK(v.size() == ref.size() && v.capacity() == v.size());
+        for (std::size_t i = 0; i < v.size(); i++)
+            CHECK(v[i].index == ref[i] && v[i].payload[0] == char(ref[i]));
+        v.resize(v.size() + 10, record(-1));
+        CHECK(v.back().index == -1);
+        v.resize(50000);
+        v.shrink_to_fit();
+        CHECK(v.capacity() == 50000 && std::size_t(v.end() - v.begin()) == 50000);
+    }
+    {
+        Mapped  v(testFile, Mapped::read_only);
+        bool    thrown = false;
+
+        CHECK(v.size() == 50000 && v.back().index == ref[49999]);
+        try
+        {
+            v.at(50000);
+        }
+        catch (std::out_of_range &)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+    }
+    ::unlink(testFile);
+}
+
+FT_TEST(mapped_vector_rejects_files)
+{
+    int     failures = 0;
+
+    ::unlink(testFile);
+    {
+        Mapped  v(testFile);
+
+        v.push_back(record(1));
+    }
+    try
+    {
+        ft::mapped_vector<double>   wrongType(testFile);
+    }
+    catch (std::runtime_error &)
+    {
+        failures++;
+    }
+    try
+    {
+        Mapped  missing("/nonexistent/ft_tests.dat");
+    }
+    catch (std::runtime_error &)
+    {
+        failures++;
+    }
+    CHECK(failures == 2);
+    {
+        Mapped  a(testFile);
+        Mapped  b;
+
+        a.clear();
+        a.push_back(record(7));
+        a.swap(b);
+        CHECK(!a.is_open() && b.size() == 1 && b[0].index == 7);
+    }
+    CHECK(fileSize(testFile) == long(64 + sizeof(Record)));
+    ::unlink(testFile);
+}
+
+FT_TEST(vector_mmap_allocator)
+{
+    ft::vector<long, ft::mmap_allocator<long>, ft::page_growth_policy<> >  v;
+    std::vector<long>                                                       r;
+
+    std::srand(5);
+    for (int i = 0; i < 100000; i++)
+    {
+        int     op = std::rand() % 10;
+        long    x = std::rand();
+
+        if (op < 6)
+        {
+            v.push_back(x);
+            r.push_back(x);
+        }
+        else if (op == 6 && !r.empty())
+        {
+            std::size_t pos = std::rand() % r.size();
+
+            v.insert(v.begin() + pos, 5, x);
+            r.insert(r.begin() + pos, 5, x);
+        }
+        else if (op == 7 && !r.empty())
+        {
+            std::size_t pos = std::rand() % r.size();
+
+            v.erase(v.begin() + pos);
+            r.erase(r.begin() + pos);
+        }
+        else if (op == 8 && std::rand() % 500 == 0)
+            v.shrink_to_fit();
+        else if (op == 9 && std::rand() % 500 == 0)
+            v.reserve_exact(r.size() + 1000000);
+    }
+    CHECK(v.size() == r.size());
+    for (std::size_t i = 0; i < r.size(); i++)
+        CHECK(v[i] == r[i]);
+
+    ft::vector<std::string, ft::mmap_allocator<std::string> >   s;
+
+    for (int i = 0; i < 20000; i++)
+        s.push_back(std::string(i % 50, 'q'));
+    s.insert(s.begin() + 5, 3, "abc");
+    s.shrink_to_fit();
+    for (int i = 0; i < 20000; i++)
+        CHECK(s[i < 5 ? i : i + 3].size() == std::size_t(i % 50));
+}
@@ -0,0 +1,23 @@
+#include <string>
+#include "Test.hpp"
+#include "Utils/Pair.hpp"
+
+# if __cplusplus >= 201103L
+FT_TEST(pair_forwarding_constructor_is_constrained)
+{
+    typedef ft::pair<int, std::string>  Pair;
+
+    CHECK((std::is_constructible<Pair, int, const char *>::value));
+    CHECK((std::is_constructible<Pair, long, std::string &&>::value));
+    CHECK((!std::is_constructible<Pair, int, int>::value));
+    CHECK((!std::is_constructible<Pair, std::string, std::string>::value));
+    CHECK((!std::is_convertible<int, Pair>::value));
+
+    Pair        p(1, "one");
+    Pair        copy(p);
+    Pair        moved(2, std::string("two"));
+
+    CHECK(copy.first == 1 && copy.second == "one" && p.second == "one");
+    CHECK(moved.second == "two");
+}
+# endif
@@ -0,0 +1,227 @@
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include "Test.hpp"
+#include "small_vector.hpp"
+
+namespace
+{
+    typedef ft::small_vector<std::string, 4>    Small;
+    typedef std::vector<std::string>            Ref;
+
+    void    checkSame(const Small &v, const Ref &r)
+    {
+        CHECK(v.size() == r.size());
+        for (std::size_t i = 0; i < r.size(); i++)
+            CHECK(v[i] == r[i]);
+
+        std::size_t i = 0;
+
+        for (Small::const_iterator it = v.begin(); it != v.end(); ++it, ++i)
+            CHECK(*it == r[i]);
+        CHECK(v.capacity() >= v.size() && v.capacity() >= Small::inline_capacity);
+        CHECK(v.is_inline() == (v.capacity() == Small::inline_capacity));
+    }
+}
+
+// Two vectors crossing the inline limit back and forth, swapped, copied
+// and moved in every combination of inline and heap storage.
+FT_TEST(small_vector_random_ops)
+{
+    Small   a;
+    Small   b;
+    Ref     ra;
+    Ref     rb;
+    char    buf[16];
+
+    std::srand(3);
+    for (int step = 0; step < 20000; step++)
+    {
+        int op = std::rand() % 9;
+
+        std::sprintf(buf, "s%d", std::rand() % 100);
+
+        std::string value(buf);
+
+        if (op < 2)
+        {
+            a.push_back(value);
+            ra.push_back(value);
+        }
+        else if (op == 2 && !ra.empty())
+        {
+            a.pop_back();
+            ra.pop_back();
+        }
+        else if (op == 3)
+        {
+            std::size_t pos = ra.empty() ? 0 : std::rand() % ra.size();
+
+            a.insert(a.begin() + pos, value);
+            ra.insert(ra.begin() + pos, value);
+        }
+        else if (op == 4 && !ra.empty())
+        {
+            std::size_t pos = std::rand() % ra.size();
+
+            a.erase(a.begin() + pos);
+            ra.erase(ra.begin() + pos);
+        }
+        else if (op == 5)
+        {
+            a.swap(b);
+            ra.swap(rb);
+        }
+        else if (op == 6 && std::rand() % 10 == 0)
+        {
+            a.clear();
+            ra.clear();
+        }
+        else if (op == 7)
+        {
+            Small   copy(a);
+            Small   assigned;
+            Small   range(a.begin(), a.end());
+
+            assigned = b;
+            checkSame(copy, ra);
+            checkSame(assigned, rb);
+            checkSame(range, ra);
+            CHECK(copy == a && !(copy < a));
+        }
+# if __cplusplus >= 201103L
+        else if (op == 8)
+        {
+            Small   moved(std::move(a));
+
+            CHECK(a.empty());
+            checkSame(moved, ra);
+            a = std::move(moved);
+            if (std::rand() % 2)
+            {
+                b = std::move(a);
+                rb = ra;
+                ra.clear();
+            }
+        }
+# endif
+        checkSame(a, ra);
+        checkSame(b, rb);
+    }
+}
+
+FT_TEST(small_vector_inline_limit)
+{
+    Small   few(3, "x");
+    Small   many(9, "y");
+
+    CHECK(few.size() == 3 && few.is_inline());
+    CHECK(many.size() == 9 && !many.is_inline());
+    ft::swap(few, many);
+    CHECK(few.size() == 9 && many.size() == 3 && many[2] == "x");
+    many.shrink_to_fit();
+    CHECK(many.is_inline() && many.size() == 3);
+    few.erase(few.begin() + 2, few.end());
+    few.shrink_to_fit();
+    CHECK(few.is_inline() && few.size() == 2 && few[1] == "y");
+
+    ft::small_vector<int, 16>   ints;
+
+    for (int i = 0; i < 16; i++)
+        ints.push_back(i);
+    CHECK(ints.is_inline());
+    ints.push_back(16);
+    CHECK(!ints.is_inline() && ints.back() == 16);
+}
+
+namespace
+{
+    // Counts its outstanding blocks in its own counter; allocators with
+    // different counters are unequal, so a block freed by the wrong one
+    // leaves both counters off.
+    template<class T>
+    struct CountingAllocator: std::allocator<T>
+    {
+        template<class U>
+        struct rebind { typedef CountingAllocator<U> other; };
+
+        long    *live;
+
+        explicit CountingAllocator(long *counter = NULL): live(counter) {}
+        template<class U>
+        CountingAllocator(const CountingAllocator<U> &other): live(other.live) {}
+
+        T   *allocate(std::size_t n, const void * = 0)
+        {
+            ++*this->live;
+            return std::allocator<T>::allocate(n);
+        }
+
+        void    deallocate(T *p, std::size_t n)
+        {
+            --*this->live;
+            std::allocator<T>::deallocate(p, n);
+        }
+
+        bool    operator==(const CountingAllocator &other) const { return this->live == other.live; }
+        bool    operator!=(const CountingAllocator &other) const { return this->live != other.live; }
+    };
+}
+
+// Heap buffers only change hands between equal allocators; with unequal
+// ones swap and move assignment fall back to moving the elements.
+FT_TEST(small_vector_stateful_allocator)
+{
+    typedef ft::small_vector<std::string, 2, CountingAllocator<std::string> >  Counted;
+
+    long    liveA = 0;
+    long    liveB = 0;
+    {
+        Counted a((CountingAllocator<std::string>(&liveA)));
+        Counted b((CountingAllocator<std::string>(&liveB)));
+        Counted c((CountingAllocator<std::string>(&liveA)));
+
+        for (int i = 0; i < 10; i++)
+        {
+            a.push_back("a");
+            c.push_back("c");
+        }
+        for (int i = 0; i < 5; i++)
+            b.push_back("b");
+        a.swap(b);
+        CHECK(a.size() == 5 && a[4] == "b" && b.size() == 10 && b[9] == "a");
+        b.swap(c);
+        CHECK(b.size() == 10 && b[0] == "c" && c[0] == "a");
+        b.shrink_to_fit();
+        CHECK(liveA == 2 && liveB == 1);
+# if __cplusplus >= 201103L
+        a = std::move(c);
+        CHECK(a.size() == 10 && a[0] == "a" && c.empty() && c.is_inline());
+        c = std::move(b);
+        CHECK(c.size() == 10 && c[0] == "c" && b.empty() && b.is_inline());
+# endif
+    }
+    CHECK(liveA == 0 && liveB == 0);
+}
+
+# if __cplusplus >= 201103L
+namespace
+{
+    struct alignas(32) Wide
+    {
+        double  v[4];
+    };
+}
+
+FT_TEST(small_vector_over_aligned_inline)
+{
+    ft::small_vector<Wide, 3>   v;
+    Wide                        w = Wide();
+
+    for (int i = 0; i < 3; i++)
+        v.push_back(w);
+    CHECK(v.is_inline() && reinterpret_cast<std::size_t>(v.data()) % 32 == 0);
+}
+# endif
@@ -0,0 +1,302 @@
+#include <map>
+#include <set>
+#include <string>
+#include <stdexcept>
+#include <memory>
+#include <new>
+#include <cstdio>
+#include <cstdlib>
+#include "Test.hpp"
+#include "unordered_map.hpp"
+#include "unordered_set.hpp"
+
+namespace
+{
+    typedef ft::unordered_map<int, std::string> Map;
+    typedef std::map<int, std::string>          Ref;
+
+    std::string name(int x)
+    {
+        char    buf[32];
+
+        std::sprintf(buf, "v%d", x);
+        return buf;
+    }
+
+    // Iteration must visit every element exactly once, in any order.
+    void    checkSame(const Map &m, const Ref &r)
+    {
+        std::size_t n = 0;
+
+        CHECK(m.size() == r.size());
+        for (Map::const_iterator it = m.begin(); it != m.end(); ++it, ++n)
+        {
+            Ref::const_iterator ri = r.find(it->first);
+
+            CHECK(ri != r.end() && ri->second == it->second);
+        }
+        CHECK(n == r.size());
+        CHECK(m.bucket_count() == 0 || m.load_factor() <= m.max_load_factor() + 1e-6);
+    }
+
+    struct StringHash
+    {
+        typedef void    is_transparent;
+
+        std::size_t operator()(const std::string &s) const { return ft::hash<std::string>()(s); }
+        std::size_t operator()(const char *s) const { return ft::hash<std::string>()(std::string(s)); }
+    };
+
+    struct StringEqual
+    {
+        typedef void    is_transparent;
+
+        bool    operator()(const std::string &a, const std::string &b) const { return a == b; }
+        bool    operator()(const std::string &a, const char *b) const { return a == b; }
+        bool    operator()(const char *a, const std::string &b) const { return b == a; }
+    };
+
+    // Four distinct hashes only: long probe sequences and many tombstones.
+    struct CollidingHash
+    {
+        std::size_t operator()(int x) const { return x & 3; }
+    };
+
+    // Allocations left before BudgetAllocator throws; negative for no limit.
+    long    allocBudget = -1;
+
+    template<class T>
+    struct BudgetAllocator: std::allocator<T>
+    {
+        template<class U>
+        struct rebind { typedef BudgetAllocator<U> other; };
+
+        BudgetAllocator() {}
+        template<class U>
+        BudgetAllocator(const BudgetAllocator<U> &) {}
+
+        T   *allocate(std::size_t n, const void * = 0)
+        {
+            if (allocBudget == 0)
+                throw std::bad_alloc();
+            if (allocBudget > 0)
+                allocBudget--;
+            return std::allocator<T>::allocate(n);
+        }
+    };
+}
+
+FT_TEST(unordered_map_insert_erase)
+{
+    Map m;
+    Ref r;
+
+    std::srand(7);
+    for (int step = 0; step < 60000; step++)
+    {
+        int k = std::rand() % (step < 30000 ? 3000 : 300);
+        int op = std::rand() % 6;
+
+        if (op < 2)
+        {
+            ft::pair<Map::iterator, bool>   res = m.insert(ft::make_pair(k, name(k)));
+
+            CHECK(res.second == r.insert(std::make_pair(k, name(k))).second && res.first->first == k);
+        }
+        else if (op < 4)
+            CHECK(m.erase(k) == r.erase(k));
+        else if (op == 4)
+        {
+            Map::iterator   it = m.find(k);
+
+            CHECK((it == m.end()) == !r.count(k));
+            if (it != m.end())
+            {
+                m.erase(it);
+                r.erase(k);
+            }
+        }
+        else
+        {
+            m[k] += "x";
+            r[k] += "x";
+            CHECK(m.at(k) == r[k]);
+        }
+        if (step % 1000 == 0)
+            checkSame(m, r);
+    }
+    checkSame(m, r);
+
+    bool    thrown = false;
+
+    try
+    {
+        m.at(-1);
+    }
+    catch (std::out_of_range &)
+    {
+        thrown = true;
+    }
+    CHECK(thrown);
+
+    // Erasing while iterating keeps the rest of the walk valid.
+    for (Map::iterator it = m.begin(); it != m.end(); )
+    {
+        Map::iterator   cur = it++;
+
+        if (cur->first % 2)
+        {
+            r.erase(cur->first);
+            m.erase(cur);
+        }
+    }
+    checkSame(m, r);
+}
+
+FT_TEST(unordered_map_rehash_reserve)
+{
+    Map m;
+    Ref r;
+
+    for (int i = 0; i < 5000; i++)
+    {
+        m[i * 13] = name(i);
+        r[i * 13] = name(i);
+    }
+    m.reserve(40000);
+    CHECK(m.bucket_count() * m.max_load_factor() >= 40000);
+    checkSame(m, r);
+
+    std::size_t buckets = m.bucket_count();
+
+    for (int i = 5000; i < 40000; i++)
+    {
+        m[i * 13] = name(i);
+        r[i * 13] = name(i);
+    }
+    CHECK(m.bucket_count() == buckets);
+    checkSame(m, r);
+    for (int i = 0; i < 40000; i += 3)
+    {
+        m.erase(i * 13);
+        r.erase(i * 13);
+    }
+    m.rehash(0);
+    checkSame(m, r);
+    m.max_load_factor(0.5f);
+    checkSame(m, r);
+    m.rehash(100000);
+    CHECK(m.bucket_count() >= 100000);
+    checkSame(m, r);
+
+    ft::unordered_map<int, int, CollidingHash>  bad;
+
+    for (int i = 0; i < 2000; i++)
+        bad[i] = i;
+    for (int i = 0; i < 2000; i += 2)
+        bad.erase(i);
+    for (int i = 0; i < 2000; i++)
+        CHECK(bad.count(i) == std::size_t(i % 2));
+}
+
+FT_TEST(unordered_map_copy_and_swap)
+{
+    Map m;
+    Ref r;
+
+    for (int i = 0; i < 3000; i++)
+    {
+        m[i * 7] = name(i);
+        r[i * 7] = name(i);
+    }
+
+    Map copy(m);
+    Map assigned;
+
+    assigned[1] = "gone";
+    assigned = copy;
+    CHECK(copy == m && assigned == m);
+    checkSame(assigned, r);
+    copy.erase(copy.begin(), copy.end());
+    CHECK(copy.empty() && copy.begin() == copy.end() && copy != m);
+    copy.swap(assigned);
+    checkSame(copy, r);
+    CHECK(assigned.empty());
+
+    Map empty;
+    const Map   &constEmpty = empty;
+
+    CHECK(empty.begin() == empty.end() && empty.find(3) == empty.end() && empty.erase(3) == 0);
+    CHECK(constEmpty.begin() == constEmpty.end());
+}
+
+// A rehash that fails on either of its two allocations leaves the table
+// as it was: every element still there, further inserts and the
+// destructor still work.
+FT_TEST(unordered_map_failed_rehash)
+{
+    typedef ft::unordered_map<int, int, ft::hash<int>, std::equal_to<int>, BudgetAllocator<ft::pair<const int, int> > >    BudgetMap;
+
+    for (long budget = 0; budget < 2; budget++)
+    {
+        BudgetMap   m;
+        int         next = 0;
+        bool        thrown = false;
+
+        for (; next < 1000; next++)
+            m[next] = next;
+        allocBudget = budget;
+        try
+        {
+            for (; next < 100000; next++)
+                m[next] = next;
+        }
+        catch (std::bad_alloc &)
+        {
+            thrown = true;
+        }
+        allocBudget = -1;
+        CHECK(thrown && m.size() == std::size_t(next));
+        for (int i = 0; i < next; i++)
+            CHECK(m.count(i) == 1 && m[i] == i);
+        for (int i = next; i < next + 5000; i++)
+            m[i] = i;
+        CHECK(m.size() == std::size_t(next + 5000));
+    }
+}
+
+FT_TEST(unordered_set_basic)
+{
+    ft::unordered_set<int>  s;
+    std::set<int>           r;
+
+    std::srand(11);
+    for (int step = 0; step < 20000; step++)
+    {
+        int k = std::rand() % 2000;
+
+        if (std::rand() % 2)
+            CHECK(s.insert(k).second == r.insert(k).second);
+        else
+            CHECK(s.erase(k) == r.erase(k));
+    }
+    CHECK(s.size() == r.size());
+    for (ft::unordered_set<int>::iterator it = s.begin(); it != s.end(); ++it)
+        CHECK(r.count(*it) == 1);
+
+    ft::unordered_set<int>  copy(s);
+
+    CHECK(copy == s);
+}
+
+FT_TEST(unordered_map_heterogeneous_lookup)
+{
+    ft::unordered_map<std::string, int, StringHash, StringEqual>            m;
+    const ft::unordered_map<std::string, int, StringHash, StringEqual>      &cm = m;
+
+    m["alpha"] = 1;
+    m["beta"] = 2;
+    CHECK(m.find("alpha")->second == 1 && m.count("gamma") == 0);
+    CHECK(m.find(std::string("beta"))->second == 2);
+    CHECK(cm.equal_range("beta").first->second == 2);
+}
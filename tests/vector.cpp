@@ -0,0 +1,260 @@
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include "Test.hpp"
+#include "vector.hpp"
+
+namespace
+{
+    int live = 0;
+
+    // Element that owns memory and counts its live instances.
+    struct Counted
+    {
+        std::string s;
+
+        Counted(): s("x") { live++; }
+        Counted(const Counted &o): s(o.s) { live++; }
+        Counted(const std::string &v): s(v) { live++; }
+        Counted &operator=(const Counted &o) { s = o.s; return *this; }
+        ~Counted() { live--; }
+        bool    operator==(const Counted &o) const { return s == o.s; }
+        bool    operator!=(const Counted &o) const { return s != o.s; }
+    };
+
+    template<class V, class S>
+    void    checkSame(const V &v, const S &s)
+    {
+        CHECK(v.size() == s.size() && v.capacity() >= v.size());
+        for (std::size_t i = 0; i < s.size(); i++)
+            CHECK(v[i] == s[i]);
+    }
+
+    template<class V, class S, class Make>
+    void    randomOps(V &v, S &s, Make make, int rounds)
+    {
+        for (int i = 0; i < rounds; i++)
+        {
+            typename S::value_type  c = make(std::rand());
+            int                     op = std::rand() % 7;
+
+            if (op < 3)
+            {
+                v.push_back(c);
+                s.push_back(c);
+            }
+            else if (op == 3 && !s.empty())
+            {
+                v.pop_back();
+                s.pop_back();
+            }
+            else if (op == 4)
+            {
+                std::size_t p = s.empty() ? 0 : std::rand() % (s.size() + 1);
+
+                v.insert(v.begin() + p, c);
+                s.insert(s.begin() + p, c);
+            }
+            else if (op == 5 && !s.empty())
+            {
+                std::size_t p = std::rand() % s.size();
+
+                v.erase(v.begin() + p);
+                s.erase(s.begin() + p);
+            }
+            else if (op == 6 && !s.empty())
+            {
+                std::size_t a = std::rand() % s.size();
+                std::size_t b = a + std::rand() % (s.size() - a + 1);
+
+                v.erase(v.begin() + a, v.begin() + b);
+                s.erase(s.begin() + a, s.begin() + b);
+            }
+            else
+            {
+                v.insert(v.begin(), 4, c);
+                s.insert(s.begin(), 4, c);
+            }
+            checkSame(v, s);
+        }
+    }
+
+    Counted makeCounted(int x)
+    {
+        char    buf[32];
+
+        std::sprintf(buf, "%d", x % 1000);
+        return Counted(buf);
+    }
+
+    int     makeInt(int x) { return x; }
+
+# if __cplusplus >= 201103L
+    // Allocator with only the C++11 minimum: construct and destroy come
+    // from std::allocator_traits.
+    template<class T>
+    struct MinimalAllocator
+    {
+        typedef T   value_type;
+
+        MinimalAllocator() {}
+        template<class U>
+        MinimalAllocator(const MinimalAllocator<U> &) {}
+
+        T       *allocate(std::size_t n) { return std::allocator<T>().allocate(n); }
+        void    deallocate(T *p, std::size_t n) { std::allocator<T>().deallocate(p, n); }
+
+        template<class U>
+        bool    operator==(const MinimalAllocator<U> &) const { return true; }
+        template<class U>
+        bool    operator!=(const MinimalAllocator<U> &) const { return false; }
+    };
+# endif
+}
+
+FT_TEST(vector_random_ops_owning)
+{
+    std::srand(3);
+    {
+        ft::vector<Counted>     v;
+        std::vector<Counted>    s;
+
+        randomOps(v, s, makeCounted, 3000);
+        CHECK(live == int(v.size() + s.size()));
+
+        ft::vector<Counted>     c(v);
+        ft::vector<Counted>     d(5, Counted("q"));
+
+        checkSame(c, s);
+        d = c;
+        checkSame(d, s);
+        d.insert(d.begin() + 2, c.begin(), c.end());
+        s.insert(s.begin() + 2, &c[0], &c[0] + c.size());
+        checkSame(d, s);
+        for (int k = 0; k < 50; k++)
+        {
+            Counted tmp(s.back());
+
+            d.insert(d.begin(), d.back());
+            s.insert(s.begin(), tmp);
+            d.insert(d.begin() + 1, 2, d[d.size() - 1]);
+            s.insert(s.begin() + 1, 2, tmp);
+        }
+        checkSame(d, s);
+        d.clear();
+        CHECK(d.empty());
+    }
+    CHECK(live == 0);
+}
+
+FT_TEST(vector_random_ops_trivial)
+{
+    ft::vector<int>     v;
+    std::vector<int>    s;
+
+    std::srand(4);
+    randomOps(v, s, makeInt, 5000);
+
+    ft::vector<int>     fill(10, 7);
+
+    CHECK(fill.size() == 10 && fill[9] == 7);
+    try
+    {
+        fill.at(10);
+        CHECK(!"at past the end must throw");
+    }
+    catch (std::out_of_range &) {}
+}
+
+# if __cplusplus >= 201103L
+FT_TEST(vector_minimal_allocator)
+{
+    ft::vector<std::string, MinimalAllocator<std::string> >    v;
+    std::vector<std::string>                                    s;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        v.push_back(std::string(i % 40, 'a'));
+        s.push_back(std::string(i % 40, 'a'));
+    }
+    v.emplace(v.begin() + 3, 5, 'z');
+    s.emplace(s.begin() + 3, 5, 'z');
+    v.erase(v.begin() + 10, v.begin() + 100);
+    s.erase(s.begin() + 10, s.begin() + 100);
+    checkSame(v, s);
+}
+# endif
+
+namespace
+{
+    // Owns a heap pointer but opts into bitwise relocation.
+    struct Boxed
+    {
+        int *p;
+
+        Boxed(int v = 0): p(new int(v)) {}
+        Boxed(const Boxed &o): p(new int(*o.p)) {}
+        Boxed   &operator=(const Boxed &o) { *p = *o.p; return *this; }
+        ~Boxed() { delete p; }
+        bool    operator==(const Boxed &o) const { return *p == *o.p; }
+    };
+}
+
+namespace ft
+{
+    template<>
+    struct is_trivially_relocatable<Boxed>: true_type {};
+}
+
+FT_TEST(vector_relocatable_opt_in)
+{
+    ft::vector<Boxed>   v;
+    std::vector<int>    s;
+
+    for (int i = 0; i < 2000; i++)
+    {
+        std::size_t p = s.empty() ? 0 : (i * 7919) % (s.size() + 1);
+
+        v.insert(v.begin() + p, Boxed(i));
+        s.insert(s.begin() + p, i);
+        if (i % 3 == 0)
+        {
+            v.erase(v.begin() + p / 2);
+            s.erase(s.begin() + p / 2);
+        }
+    }
+    CHECK(v.size() == s.size());
+    for (std::size_t i = 0; i < s.size(); i++)
+        CHECK(*v[i].p == s[i]);
+}
+
+// clear, erase, pop_back and resise destroy what they remove; clear keeps
+// the capacity.
+FT_TEST(vector_removal_destroys)
+{
+    CHECK(ft::is_trivially_destructible<int>::value);
+    CHECK(!ft::is_trivially_destructible<Counted>::value);
+    {
+        ft::vector<Counted> v;
+
+        for (int i = 0; i < 1000; i++)
+            v.push_back(Counted());
+        CHECK(live == 1000);
+        v.pop_back();
+        CHECK(live == 999);
+        v.erase(v.begin() + 10, v.begin() + 110);
+        CHECK(live == 899);
+        v.resise(500);
+        CHECK(live == 500);
+
+        std::size_t capacity = v.capacity();
+
+        v.clear();
+        CHECK(live == 0 && v.empty() && v.capacity() == capacity);
+        for (int i = 0; i < 10; i++)
+            v.push_back(Counted());
+    }
+    CHECK(live == 0);
+}